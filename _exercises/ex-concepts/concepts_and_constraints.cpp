@@ -1,11 +1,21 @@
+#include <algorithms.hpp>
+#include <bits.hpp>
+#include <flat_map.hpp>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
 #include <forward_list>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <new>
+#include <numeric>
 #include <set>
 #include <source_location>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -225,4 +235,685 @@ TEST_CASE("zero")
         zero(evil_vec_bool);
         CHECK(evil_vec_bool == std::vector{false, false, false});
     }
-}
\ No newline at end of file
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// algorithms selected with concept subsumption
+
+TEST_CASE("core algorithms")
+{
+    namespace alg = helpers::algorithms;
+
+    static_assert(alg::TrivialContiguousRange<std::vector<int>>);
+    static_assert(alg::TrivialContiguousRange<std::array<double, 8>>);
+    static_assert(!alg::TrivialContiguousRange<std::vector<std::string>>);
+    static_assert(!alg::TrivialContiguousRange<std::list<int>>);
+    static_assert(!alg::TrivialContiguousRange<std::vector<bool>>);
+    static_assert(alg::BitVector<std::vector<bool>&>);
+
+    SECTION("zero")
+    {
+        std::vector<int> vec = {1, 2, 3};
+        alg::zero(vec);
+        CHECK(vec == std::vector{0, 0, 0});
+
+        std::list<std::string> lst = {"one", "two", "three"};
+        alg::zero(lst);
+        CHECK(lst == std::list{""s, ""s, ""s});
+
+        std::vector<bool> vec_bool(100, true);
+        alg::zero(vec_bool);
+        CHECK(vec_bool == std::vector<bool>(100, false));
+
+        std::array<int*, 2> ptrs = {&vec[0], &vec[1]};
+        alg::zero(std::span{ptrs});
+        CHECK(ptrs == std::array<int*, 2>{nullptr, nullptr});
+    }
+
+    SECTION("fill")
+    {
+        std::vector<int> vec(10);
+        alg::fill(vec, -1);
+        CHECK(vec == std::vector<int>(10, -1));
+
+        std::vector<double> vec_dbl(10, 1.0);
+        alg::fill(vec_dbl, 0.0);
+        CHECK(vec_dbl == std::vector<double>(10, 0.0));
+
+        alg::fill(vec_dbl, -0.0);
+        CHECK(std::signbit(vec_dbl[0]));
+
+        std::vector<uint8_t> bytes(10);
+        alg::fill(bytes, 0xFF);
+        CHECK(bytes == std::vector<uint8_t>(10, 0xFF));
+
+        std::vector<bool> vec_bool(100);
+        alg::fill(vec_bool, true);
+        CHECK(vec_bool == std::vector<bool>(100, true));
+
+        std::list<std::string> lst(3);
+        alg::fill(lst, "text"s);
+        CHECK(lst == std::list{"text"s, "text"s, "text"s});
+    }
+
+    SECTION("copy")
+    {
+        const std::vector<int> vec = {1, 2, 3, 4};
+
+        std::vector<int> target(4);
+        auto last = alg::copy(vec, target.begin());
+        CHECK(target == vec);
+        CHECK(last == target.end());
+
+        std::list<int> lst;
+        alg::copy(vec, std::back_inserter(lst));
+        CHECK(lst == std::list{1, 2, 3, 4});
+
+        std::vector<long> target_long(4);
+        alg::copy(vec, target_long.begin());
+        CHECK(target_long == std::vector<long>{1, 2, 3, 4});
+    }
+
+    SECTION("sum")
+    {
+        std::vector<int> vec(1'000);
+        std::iota(vec.begin(), vec.end(), 1);
+        CHECK(alg::sum(vec) == 500'500);
+
+        std::list lst = {1.5, 2.5};
+        CHECK(alg::sum(lst) == 4.0);
+
+        std::vector words = {"a"s, "b"s, "c"s};
+        CHECK(alg::sum(words) == "abc");
+    }
+
+    SECTION("find")
+    {
+        std::vector<int> vec(1'000);
+        std::iota(vec.begin(), vec.end(), 0);
+
+        CHECK(alg::find(vec, 665) == vec.begin() + 665);
+        CHECK(alg::find(vec, 1'000) == vec.end());
+        CHECK(alg::find(vec, 5'000'000'000LL) == vec.end());
+
+        std::string text = "abcdef";
+        CHECK(alg::find(text, 'd') == text.begin() + 3);
+        CHECK(alg::find(text, 'x') == text.end());
+
+        std::vector<char> chars = {'A', 'B', 'C'};
+        CHECK(alg::find(chars, 66) == chars.begin() + 1);
+        CHECK(alg::find(chars, 66 + 256) == chars.end());
+
+        std::vector<int> codes = {65, 66, 67};
+        CHECK(alg::find(codes, 'C') == codes.begin() + 2);
+        CHECK(alg::find(codes, u'\u0100') == codes.end());
+
+        std::list lst = {"one"s, "two"s};
+        CHECK(alg::find(lst, "two"s) == std::next(lst.begin()));
+    }
+}
+
+TEST_CASE("core algorithms - benchmark", "[.benchmark]")
+{
+    namespace alg = helpers::algorithms;
+
+    constexpr size_t size = 10'000'000;
+
+    std::vector<int> vec(size, 1);
+    std::vector<int> target(size);
+    std::vector<bool> vec_bool(size, true);
+
+    BENCHMARK("zero - generic loop") { zero(vec); return vec.data(); };
+    BENCHMARK("zero - memset") { alg::zero(vec); return vec.data(); };
+
+    BENCHMARK("zero(vector<bool>) - generic loop") { zero(vec_bool); return vec_bool.size(); };
+    BENCHMARK("zero(vector<bool>) - words") { alg::zero(vec_bool); return vec_bool.size(); };
+
+    BENCHMARK("fill - generic loop")
+    {
+        for (auto& item : vec)
+            item = 42;
+        return vec.data();
+    };
+    BENCHMARK("fill - contiguous") { alg::fill(vec, 42); return vec.data(); };
+
+    BENCHMARK("copy - generic loop")
+    {
+        auto out = target.begin();
+        for (const auto& item : vec)
+            *out++ = item;
+        return out;
+    };
+    BENCHMARK("copy - memmove") { return alg::copy(vec, target.begin()); };
+
+    std::vector<float> values(size, 0.5f);
+
+    BENCHMARK("sum<float> - std::accumulate") { return std::accumulate(values.begin(), values.end(), 0.0f); };
+    BENCHMARK("sum<float> - partial sums") { return alg::sum(values); };
+
+    BENCHMARK("find - generic loop") { return std::ranges::find(vec, -1); };
+    BENCHMARK("find - blocks") { return alg::find(vec, -1); };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// word-parallel algorithms for bit ranges
+
+template <typename Rng>
+concept SetBitsViewable = requires(Rng&& rng) { helpers::bits::set_bits(std::forward<Rng>(rng)); };
+
+TEST_CASE("bit algorithms")
+{
+    using helpers::bits::DynamicBitset;
+    namespace bits = helpers::bits;
+
+    SECTION("DynamicBitset")
+    {
+        DynamicBitset bitset(130);
+        CHECK(bitset.size() == 130);
+        CHECK(bits::count(bitset) == 0);
+
+        bitset.set(0);
+        bitset.set(64);
+        bitset.set(129);
+        CHECK(bitset[64]);
+        CHECK(bits::count(bitset) == 3);
+
+        bitset.flip(64);
+        CHECK_FALSE(bitset[64]);
+
+        CHECK(DynamicBitset{true, false, true} == DynamicBitset{true, false, true});
+        CHECK(std::ranges::equal(DynamicBitset{true, false, true}, std::vector{true, false, true}));
+    }
+
+    SECTION("count")
+    {
+        std::vector<bool> vec_bool(1'000);
+        for (size_t i = 0; i < vec_bool.size(); i += 3)
+            vec_bool[i] = true;
+
+        CHECK(bits::count(vec_bool) == 334);
+        CHECK(bits::count(vec_bool, false) == 666);
+
+        CHECK(bits::count(DynamicBitset(100, true)) == 100);
+        CHECK(bits::count(DynamicBitset(100, true), false) == 0);
+    }
+
+    SECTION("find")
+    {
+        std::vector<bool> vec_bool(200);
+        CHECK(bits::find(vec_bool, true) == vec_bool.end());
+        CHECK(bits::find(vec_bool, false) == vec_bool.begin());
+
+        vec_bool[150] = true;
+        CHECK(bits::find(vec_bool, true) == vec_bool.begin() + 150);
+
+        DynamicBitset bitset(100, true);
+        CHECK(bits::find(bitset, false) == bitset.end());
+
+        bitset.reset(99);
+        CHECK(bits::find(bitset, false) - bitset.begin() == 99);
+
+        namespace alg = helpers::algorithms;
+        CHECK(alg::find(vec_bool, true) == vec_bool.begin() + 150);
+    }
+
+    SECTION("fill")
+    {
+        std::vector<bool> vec_bool(70);
+        bits::fill(vec_bool, true);
+        CHECK(vec_bool == std::vector<bool>(70, true));
+
+        vec_bool.resize(75);
+        CHECK(bits::count(vec_bool) == 70);
+
+        DynamicBitset bitset(70);
+        bits::fill(bitset, true);
+        CHECK(bitset == DynamicBitset(70, true));
+    }
+
+    SECTION("transform")
+    {
+        const DynamicBitset a = {true, true, false, false};
+        const DynamicBitset b = {true, false, true, false};
+        DynamicBitset result(4);
+
+        bits::transform(a, b, result, std::bit_and<>{});
+        CHECK(result == DynamicBitset{true, false, false, false});
+
+        bits::transform(a, b, result, std::bit_or<>{});
+        CHECK(result == DynamicBitset{true, true, true, false});
+
+        bits::transform(a, b, result, std::bit_xor<>{});
+        CHECK(result == DynamicBitset{false, true, true, false});
+
+        bits::transform(a, result, std::bit_not<>{});
+        CHECK(result == DynamicBitset{false, false, true, true});
+        CHECK(bits::count(result) == 2);
+
+        std::vector<bool> vec_bool = {true, false, true, false};
+        std::vector<bool> vec_result(4);
+        bits::transform(vec_bool, a, vec_result, std::bit_or<>{});
+        CHECK(vec_result == std::vector{true, true, true, false});
+    }
+
+    SECTION("set bits")
+    {
+        DynamicBitset bitset(200);
+        for (size_t index : {3, 64, 65, 199})
+            bitset.set(index);
+
+        std::vector<size_t> indexes;
+        std::ranges::copy(bits::set_bits(bitset), std::back_inserter(indexes));
+        CHECK(indexes == std::vector<size_t>{3, 64, 65, 199});
+
+        std::vector<bool> vec_bool(10);
+        vec_bool[9] = true;
+        CHECK(*bits::set_bits(vec_bool).begin() == 9);
+
+        const std::vector<bool> no_bits_set(5);
+        CHECK(std::ranges::distance(bits::set_bits(no_bits_set)) == 0);
+
+        static_assert(SetBitsViewable<std::vector<bool>&>);
+        static_assert(!SetBitsViewable<std::vector<bool>>); // view of a temporary would dangle
+    }
+}
+
+TEST_CASE("bit algorithms - benchmark", "[.benchmark]")
+{
+    namespace bits = helpers::bits;
+
+    constexpr size_t size = 1'000'000'000;
+
+    std::vector<bool> flags(size);
+    for (size_t i = 0; i < size; i += 7)
+        flags[i] = true;
+
+    BENCHMARK("count - bitwise loop")
+    {
+        size_t result = 0;
+        for (bool flag : flags)
+            result += flag;
+        return result;
+    };
+    BENCHMARK("count - popcount") { return bits::count(flags); };
+
+    std::vector<bool> sparse(size);
+    sparse.back() = true;
+
+    BENCHMARK("find - bitwise loop") { return std::ranges::find(sparse, true); };
+    BENCHMARK("find - countr_zero") { return bits::find(sparse, true); };
+
+    std::vector<bool> other(size, true);
+
+    BENCHMARK("xor - bitwise loop")
+    {
+        for (size_t i = 0; i < size; ++i)
+            other[i] = other[i] ^ flags[i];
+        return other.size();
+    };
+    BENCHMARK("xor - words") { bits::transform(other, flags, other, std::bit_xor<>{}); return other.size(); };
+
+    BENCHMARK("set bits - bitwise loop")
+    {
+        size_t checksum = 0;
+        for (size_t i = 0; i < size; ++i)
+            if (flags[i])
+                checksum += i;
+        return checksum;
+    };
+    BENCHMARK("set bits - words")
+    {
+        size_t checksum = 0;
+        for (size_t index : bits::set_bits(flags))
+            checksum += index;
+        return checksum;
+    };
+
+    BENCHMARK("fill - words") { bits::fill(other, true); return other.size(); };
+}
+
+
+/////////////////////////////////////////////////////////////////////////////////////
+// flat maps with heterogeneous lookup
+
+TEST_CASE("flat maps - IndexableContainer")
+{
+    using helpers::FlatHashMap;
+    using helpers::FlatSortedMap;
+
+    static_assert(IndexableContainer<FlatHashMap<std::string, std::string>>);
+    static_assert(IndexableContainer<FlatHashMap<int, int>>);
+    static_assert(IndexableContainer<FlatSortedMap<std::string, std::string>>);
+    static_assert(IndexableContainer<FlatSortedMap<int, std::string>>);
+}
+
+TEST_CASE("FlatHashMap")
+{
+    helpers::FlatHashMap<std::string, int> dict = {{"one", 1}, {"two", 2}, {"three", 3}};
+
+    SECTION("lookup without temporary strings")
+    {
+        CHECK(dict.size() == 3);
+        CHECK(dict.contains("one"));
+        CHECK(dict.contains("two"sv));
+        CHECK(dict.contains("three"s));
+        CHECK_FALSE(dict.contains("four"));
+
+        CHECK(dict.find("two")->second == 2);
+        CHECK(dict.find("four") == dict.end());
+        CHECK(dict.at("three"sv) == 3);
+        CHECK_THROWS_AS(dict.at("four"), std::out_of_range);
+    }
+
+    SECTION("operator[] inserts missing keys")
+    {
+        dict["four"] = 4;
+        CHECK(dict.size() == 4);
+        CHECK(dict["four"] == 4);
+        CHECK(dict["five"sv] == 0);
+    }
+
+    SECTION("erase")
+    {
+        CHECK(dict.erase("two") == 1);
+        CHECK(dict.erase("two") == 0);
+        CHECK_FALSE(dict.contains("two"));
+        CHECK(dict.size() == 2);
+    }
+
+    SECTION("growing, erasing & iteration")
+    {
+        helpers::FlatHashMap<int, int> numbers;
+
+        for (int i = 0; i < 10'000; ++i)
+            numbers[i] = i * i;
+
+        for (int i = 0; i < 10'000; i += 2)
+            numbers.erase(i);
+
+        CHECK(numbers.size() == 5'000);
+        CHECK(numbers.at(9'999) == 9'999 * 9'999);
+        CHECK_FALSE(numbers.contains(5'000));
+
+        long long sum_of_keys = 0;
+        for (const auto& [key, value] : numbers)
+            sum_of_keys += key;
+        CHECK(sum_of_keys == 25'000'000);
+
+        auto copy = numbers;
+        CHECK(copy.size() == 5'000);
+        CHECK(copy.at(1) == 1);
+    }
+}
+
+TEST_CASE("FlatSortedMap")
+{
+    helpers::FlatSortedMap<std::string, int> dict = {{"two", 2}, {"one", 1}, {"three", 3}, {"one", -1}};
+
+    CHECK(dict.size() == 3);
+    CHECK(dict.at("one") == 1);
+    CHECK(dict.contains("three"sv));
+    CHECK(dict.find("four") == dict.end());
+
+    dict["four"] = 4;
+    CHECK(std::ranges::is_sorted(dict, std::less{}, [](const auto& item) { return item.first; }));
+
+    CHECK(dict.erase("one") == 1);
+    CHECK(dict.size() == 3);
+
+    std::vector<std::pair<std::string, int>> items = {{"b", 2}, {"a", 1}};
+    helpers::FlatSortedMap<std::string, int> bulk_loaded{items};
+    CHECK(bulk_loaded.begin()->first == "a");
+}
+
+namespace
+{
+    struct CountingLess
+    {
+        inline static size_t comparisons = 0;
+
+        bool operator()(int a, int b) const
+        {
+            ++comparisons;
+            return a < b;
+        }
+    };
+}
+
+TEST_CASE("FlatSortedMap - copy of non-const lvalue is not sorted again")
+{
+    helpers::FlatSortedMap<int, std::string, CountingLess> dict = {{3, "three"}, {1, "one"}, {2, "two"}};
+
+    CountingLess::comparisons = 0;
+    helpers::FlatSortedMap<int, std::string, CountingLess> copy(dict);
+
+    CHECK(CountingLess::comparisons == 0);
+    CHECK(copy.size() == 3);
+    CHECK(copy.begin()->first == 1);
+}
+
+namespace
+{
+    struct AllocationBudget
+    {
+        inline static size_t remaining = std::numeric_limits<size_t>::max();
+        inline static size_t live = 0;
+    };
+
+    template <typename T>
+    struct FailingAllocator
+    {
+        using value_type = T;
+
+        FailingAllocator() = default;
+
+        template <typename U>
+        FailingAllocator(const FailingAllocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            if (AllocationBudget::remaining == 0)
+                throw std::bad_alloc{};
+            --AllocationBudget::remaining;
+            ++AllocationBudget::live;
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept
+        {
+            --AllocationBudget::live;
+            std::allocator<T>{}.deallocate(ptr, n);
+        }
+
+        bool operator==(const FailingAllocator&) const = default;
+    };
+
+    struct FailingHash
+    {
+        inline static size_t calls_until_throw = std::numeric_limits<size_t>::max();
+
+        size_t operator()(int key) const
+        {
+            if (calls_until_throw-- == 0)
+                throw std::runtime_error("hash failed");
+            return std::hash<int>{}(key);
+        }
+    };
+
+    template <typename TMap>
+    bool contains_keys_up_to(const TMap& map, int count)
+    {
+        for (int i = 0; i < count; ++i)
+            if (!map.contains(i) || map.at(i) != std::to_string(i))
+                return false;
+        return true;
+    }
+}
+
+TEST_CASE("FlatHashMap - failed growth leaves the map unchanged")
+{
+    constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+    const std::string long_value(64, 'x'); // a moved-from string would be emptied
+
+    SECTION("allocator throws")
+    {
+        for (size_t allocations_before_failure : {0, 1}) // fails on ctrl bytes or on slots
+        {
+            helpers::FlatHashMap<int, std::string, helpers::FlatHash<int>, std::equal_to<>, FailingAllocator<std::pair<int, std::string>>> map;
+
+            size_t failed_growths = 0;
+            for (int i = 0; i < 200; ++i)
+            {
+                AllocationBudget::remaining = allocations_before_failure;
+                try
+                {
+                    map[i] = std::to_string(i);
+                }
+                catch (const std::bad_alloc&)
+                {
+                    ++failed_growths;
+                    CHECK(map.size() == static_cast<size_t>(i));
+                    CHECK(contains_keys_up_to(map, i));
+                    CHECK_FALSE(map.contains(i));
+
+                    AllocationBudget::remaining = unlimited;
+                    map[i] = std::to_string(i);
+                }
+            }
+            AllocationBudget::remaining = unlimited;
+
+            CHECK(failed_growths >= 4);
+            CHECK(contains_keys_up_to(map, 200));
+        }
+
+        CHECK(AllocationBudget::live == 0);
+    }
+
+    SECTION("hash throws while items are migrated")
+    {
+        helpers::FlatHashMap<int, std::string, FailingHash> map;
+
+        size_t failed_growths = 0;
+        for (int i = 0; i < 200; ++i)
+        {
+            FailingHash::calls_until_throw = 1 + static_cast<size_t>(i) / 2; // the key itself, then half of the items
+            try
+            {
+                map[i] = long_value + std::to_string(i);
+            }
+            catch (const std::runtime_error&)
+            {
+                ++failed_growths;
+                FailingHash::calls_until_throw = unlimited;
+
+                CHECK(map.size() == static_cast<size_t>(i));
+                CHECK_FALSE(map.contains(i));
+                for (int j = 0; j < i; ++j)
+                    CHECK(map.at(j) == long_value + std::to_string(j));
+
+                map[i] = long_value + std::to_string(i);
+            }
+        }
+        FailingHash::calls_until_throw = unlimited;
+
+        CHECK(failed_growths >= 4);
+        CHECK(map.size() == 200);
+    }
+}
+
+namespace
+{
+    struct AllocatedBytes
+    {
+        inline static size_t value = 0;
+    };
+
+    template <typename T>
+    struct CountingAllocator
+    {
+        using value_type = T;
+
+        CountingAllocator() = default;
+
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            AllocatedBytes::value += n * sizeof(T);
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept
+        {
+            AllocatedBytes::value -= n * sizeof(T);
+            std::allocator<T>{}.deallocate(ptr, n);
+        }
+
+        bool operator==(const CountingAllocator&) const = default;
+    };
+
+    template <typename TMap>
+    TMap build_map(const std::vector<std::string>& keys, size_t& allocated_bytes)
+    {
+        const size_t bytes_before = AllocatedBytes::value;
+
+        TMap map;
+        if constexpr (requires { map.capacity(); }) // sorted vector - bulk load with a single sort
+            map = TMap{keys | std::views::transform([](const auto& key) { return std::pair{key, key}; })};
+        else
+        {
+            for (const auto& key : keys)
+                map[key] = key;
+        }
+
+        allocated_bytes = AllocatedBytes::value - bytes_before;
+        return map;
+    }
+}
+
+TEST_CASE("flat maps - benchmark", "[.benchmark]")
+{
+    using Item = std::pair<const std::string, std::string>;
+    using FlatItem = std::pair<std::string, std::string>;
+
+    constexpr size_t size = 1'000'000;
+
+    std::vector<std::string> keys;
+    keys.reserve(size);
+    for (size_t i = 0; i < size; ++i)
+        keys.push_back("config.key." + std::to_string(i * 7919 % size)); // longer than SSO buffer
+
+    std::vector<const char*> lookup_keys;
+    for (size_t i = 0; i < size; i += 3)
+        lookup_keys.push_back(keys[i].c_str());
+
+    size_t map_bytes{}, unordered_map_bytes{}, flat_hash_map_bytes{}, flat_sorted_map_bytes{};
+
+    auto map = build_map<std::map<std::string, std::string, std::less<std::string>, CountingAllocator<Item>>>(keys, map_bytes);
+    auto unordered_map = build_map<std::unordered_map<std::string, std::string, std::hash<std::string>, std::equal_to<std::string>, CountingAllocator<Item>>>(keys, unordered_map_bytes);
+    auto flat_hash_map = build_map<helpers::FlatHashMap<std::string, std::string, helpers::FlatHash<std::string>, std::equal_to<>, CountingAllocator<FlatItem>>>(keys, flat_hash_map_bytes);
+    auto flat_sorted_map = build_map<helpers::FlatSortedMap<std::string, std::string, std::less<>, CountingAllocator<FlatItem>>>(keys, flat_sorted_map_bytes);
+
+    std::cout << "container memory (without heap allocated key/value strings):\n"
+              << "  std::map:           " << map_bytes / 1024 << " KB\n"
+              << "  std::unordered_map: " << unordered_map_bytes / 1024 << " KB\n"
+              << "  FlatHashMap:        " << flat_hash_map_bytes / 1024 << " KB\n"
+              << "  FlatSortedMap:      " << flat_sorted_map_bytes / 1024 << " KB\n";
+
+    auto lookup_all = [&lookup_keys](const auto& dict) {
+        size_t found = 0;
+        for (const char* key : lookup_keys)
+            found += dict.find(key) != dict.end();
+        return found;
+    };
+
+    BENCHMARK("std::map - lookup by const char*") { return lookup_all(map); };
+    BENCHMARK("std::unordered_map - lookup by const char*") { return lookup_all(unordered_map); };
+    BENCHMARK("FlatHashMap - lookup by const char*") { return lookup_all(flat_hash_map); };
+    BENCHMARK("FlatSortedMap - lookup by const char*") { return lookup_all(flat_sorted_map); };
+}
@@ -20,7 +20,7 @@ std::ostream& operator<<(std::ostream& out, const std::pair<T1, T2>& p)
 
 using namespace std::literals;
 
-std::pair<std::string_view, std::string_view> split(std::string_view line, std::string_view separator = "/")
+constexpr std::pair<std::string_view, std::string_view> split(std::string_view line, std::string_view separator = "/")
 {
     std::pair<std::string_view, std::string_view> result;
 
@@ -46,6 +46,8 @@ TEST_CASE("split")
 
     std::string s4 = "/434";
     CHECK(split(s4) == std::pair{""sv, "434"sv});
+
+    static_assert(split("324/44") == std::pair{"324"sv, "44"sv}); // literals are split at compile time
 }
 
 TEST_CASE("Exercise - ranges")
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Compares two benchmark reports (--json output of bench-* executables).
+
+Usage:
+    compare.py BASELINE CONTENDER [--threshold PERCENT] [--alpha P] [--metric median|mean|min]
+
+BASELINE & CONTENDER are JSON reports or directories of reports (e.g. results of the run-benchmarks target
+before & after a change) - reports are matched by file name, benchmarks by name.
+
+A benchmark is reported as a regression (or improvement) when its time changed by more than the threshold
+and the difference of repetition samples is significant (two-sided Mann-Whitney U test).
+Exit code is 1 if any regression was found.
+"""
+
+import argparse
+import json
+import math
+import sys
+from pathlib import Path
+
+
+def load_reports(path):
+    """Returns {report name: {benchmark name: benchmark}}."""
+    path = Path(path)
+    files = sorted(path.glob("*.json")) if path.is_dir() else [path]
+    reports = {}
+    for file in files:
+        with open(file, encoding="utf-8") as f:
+            report = json.load(f)
+        reports[file.stem if path.is_dir() else ""] = {b["name"]: b for b in report["benchmarks"]}
+    return reports
+
+
+def mann_whitney_p_value(xs, ys):
+    """Two-sided p-value of the Mann-Whitney U test (normal approximation with tie correction)."""
+    n1, n2 = len(xs), len(ys)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+
+    ranked = sorted([(v, 0) for v in xs] + [(v, 1) for v in ys])
+    ranks = [0.0] * len(ranked)
+    tie_term = 0.0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        t = j - i + 1
+        tie_term += t**3 - t
+        i = j + 1
+
+    rank_sum = sum(r for r, (_, group) in zip(ranks, ranked) if group == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0.0:
+        return 1.0
+
+    z = (abs(u - n1 * n2 / 2.0) - 0.5) / math.sqrt(variance)
+    return math.erfc(max(z, 0.0) / math.sqrt(2.0))
+
+
+def format_time(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.2f} {unit}"
+    return f"{ns:.2f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compares two benchmark reports")
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=5.0, help="minimal relevant change in percent (default: 5)")
+    parser.add_argument("--alpha", type=float, default=0.05, help="significance level (default: 0.05)")
+    parser.add_argument("--metric", choices=("median", "mean", "min"), default="median")
+    args = parser.parse_args()
+
+    baseline = load_reports(args.baseline)
+    contender = load_reports(args.contender)
+
+    print(f"{'Benchmark':<56}{'Baseline':>14}{'Contender':>14}{'Change':>10}{'p-value':>10}  Verdict")
+    print("-" * 114)
+
+    regressions = 0
+    for report in sorted(baseline.keys() & contender.keys()):
+        old_benchmarks, new_benchmarks = baseline[report], contender[report]
+        for name in old_benchmarks:
+            if name not in new_benchmarks:
+                continue
+            old, new = old_benchmarks[name], new_benchmarks[name]
+
+            old_time, new_time = old[args.metric], new[args.metric]
+            change = (new_time - old_time) / old_time * 100.0 if old_time > 0 else 0.0
+            p_value = mann_whitney_p_value(old.get("samples", []), new.get("samples", []))
+
+            verdict = ""
+            if abs(change) >= args.threshold and p_value < args.alpha:
+                verdict = "SLOWER" if change > 0 else "faster"
+                regressions += change > 0
+
+            label = f"{report}: {name}" if report else name
+            print(f"{label:<56}{format_time(old_time):>14}{format_time(new_time):>14}{change:>+9.1f}%{p_value:>10.3f}  {verdict}")
+
+        for name in sorted(old_benchmarks.keys() ^ new_benchmarks.keys()):
+            side = "baseline" if name in old_benchmarks else "contender"
+            print(f"{(report + ': ' if report else '') + name:<56}  only in {side}")
+
+    for report in sorted(baseline.keys() ^ contender.keys()):
+        print(f"report {report} - only in {'baseline' if report in baseline else 'contender'}")
+
+    if regressions:
+        print(f"\n{regressions} regression(s) above {args.threshold}%")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,134 @@
+#include <benchmark.hpp>
+#include <integer_compare.hpp>
+#include <radix_sort.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+template <typename T>
+std::vector<T> random_values(size_t size, uint32_t seed = 665)
+{
+    std::mt19937_64 rnd_gen{seed};
+    std::vector<T> data(size);
+    std::ranges::generate(data, [&] { return static_cast<T>(rnd_gen()); });
+    return data;
+}
+
+////////////////////////////////////////////////////////////////////////
+// radix sort vs comparison sort
+
+void bm_sort_uint32_std_sort(bench::State& state)
+{
+    const auto source = random_values<uint32_t>(static_cast<size_t>(state.range(0)));
+    std::vector<uint32_t> data(source.size());
+
+    for (auto _ : state)
+    {
+        state.pause_timing();
+        std::ranges::copy(source, data.begin());
+        state.resume_timing();
+
+        std::sort(data.begin(), data.end());
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+void bm_sort_uint32_radix_sort(bench::State& state)
+{
+    const auto source = random_values<uint32_t>(static_cast<size_t>(state.range(0)));
+    std::vector<uint32_t> data(source.size());
+
+    for (auto _ : state)
+    {
+        state.pause_timing();
+        std::ranges::copy(source, data.begin());
+        state.resume_timing();
+
+        helpers::radix_sort(data);
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+BENCHMARK(bm_sort_uint32_std_sort)->range(1 << 10, 1 << 22, 64);
+BENCHMARK(bm_sort_uint32_radix_sort)->range(1 << 10, 1 << 22, 64);
+
+////////////////////////////////////////////////////////////////////////
+// comparisons of signed & unsigned columns
+
+void bm_cmp_less_std_cmp_less(bench::State& state)
+{
+    const auto lhs = random_values<int32_t>(static_cast<size_t>(state.range(0)), 1);
+    const auto rhs = random_values<uint32_t>(lhs.size(), 2);
+    std::vector<bool> result(lhs.size());
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < lhs.size(); ++i)
+            result[i] = std::cmp_less(lhs[i], rhs[i]);
+        bench::DoNotOptimize(result);
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * lhs.size()));
+}
+
+void bm_cmp_less_helpers_cmp_less(bench::State& state)
+{
+    const auto lhs = random_values<int32_t>(static_cast<size_t>(state.range(0)), 1);
+    const auto rhs = random_values<uint32_t>(lhs.size(), 2);
+    helpers::bits::DynamicBitset result(lhs.size());
+
+    for (auto _ : state)
+    {
+        helpers::cmp_less(lhs, rhs, result);
+        bench::DoNotOptimize(result);
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * lhs.size()));
+}
+
+BENCHMARK(bm_cmp_less_std_cmp_less)->arg(1 << 20);
+BENCHMARK(bm_cmp_less_helpers_cmp_less)->arg(1 << 20);
+
+////////////////////////////////////////////////////////////////////////
+// checked narrowing of a column
+
+void bm_narrow_std_in_range(bench::State& state)
+{
+    const std::vector<int64_t> source(static_cast<size_t>(state.range(0)), 42);
+    std::vector<int32_t> dest(source.size());
+
+    for (auto _ : state)
+    {
+        size_t converted = 0;
+        for (; converted < source.size() && std::in_range<int32_t>(source[converted]); ++converted)
+            dest[converted] = static_cast<int32_t>(source[converted]);
+        bench::DoNotOptimize(converted);
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * source.size()));
+}
+
+void bm_narrow_helpers_narrow_into(bench::State& state)
+{
+    const std::vector<int64_t> source(static_cast<size_t>(state.range(0)), 42);
+    std::vector<int32_t> dest(source.size());
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(helpers::narrow_into(source, dest));
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * source.size()));
+}
+
+BENCHMARK(bm_narrow_std_in_range)->arg(1 << 20);
+BENCHMARK(bm_narrow_helpers_narrow_into)->arg(1 << 20);
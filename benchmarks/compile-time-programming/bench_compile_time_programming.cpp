@@ -0,0 +1,114 @@
+#include <arena.hpp>
+#include <benchmark.hpp>
+#include <datasets.hpp>
+#include <numeric_array.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////
+// element-wise arithmetic - expression templates vs chained algorithms
+
+void bm_expression_chained_transform(bench::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    helpers::NumericArray<float> a(size, 1.5f);
+    helpers::NumericArray<float> b(size, 2.0f);
+    helpers::NumericArray<float> c(size, 0.5f);
+    helpers::NumericArray<float> result(size);
+
+    for (auto _ : state)
+    {
+        std::vector<float> ab(size);
+        std::vector<float> c2(size);
+        std::ranges::transform(a, b, ab.begin(), std::multiplies{});
+        std::ranges::transform(c, c2.begin(), [](float x) { return x * 2.0f; });
+        std::ranges::transform(ab, c2, ab.begin(), std::plus{});
+        std::ranges::transform(ab, a, result.begin(), std::minus{});
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * size));
+}
+
+void bm_expression_template(bench::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    helpers::NumericArray<float> a(size, 1.5f);
+    helpers::NumericArray<float> b(size, 2.0f);
+    helpers::NumericArray<float> c(size, 0.5f);
+    helpers::NumericArray<float> result(size);
+
+    for (auto _ : state)
+    {
+        result = a * b + c * 2.0f - a;
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * size));
+}
+
+BENCHMARK(bm_expression_chained_transform)->arg(1 << 12)->arg(1 << 24);
+BENCHMARK(bm_expression_template)->arg(1 << 12)->arg(1 << 24);
+
+////////////////////////////////////////////////////////////////////////
+// transient containers - heap vs arena
+
+void bm_transient_vector_heap(bench::State& state)
+{
+    int value = 0;
+
+    for (auto _ : state)
+    {
+        std::vector<int> items;
+        for (int i = 0; i < 32; ++i)
+            items.push_back(value + i);
+        bench::DoNotOptimize(items.data());
+        ++value;
+    }
+}
+
+void bm_transient_vector_stack_arena(bench::State& state)
+{
+    int value = 0;
+    helpers::StackArena<1024> arena;
+
+    for (auto _ : state)
+    {
+        {
+            std::vector<int, helpers::ArenaAllocator<int>> items{helpers::ArenaAllocator<int>{arena}};
+            for (int i = 0; i < 32; ++i)
+                items.push_back(value + i);
+            bench::DoNotOptimize(items.data());
+        }
+        arena.release();
+        ++value;
+    }
+}
+
+BENCHMARK(bm_transient_vector_heap);
+BENCHMARK(bm_transient_vector_stack_arena);
+
+////////////////////////////////////////////////////////////////////////
+// runtime generation of test datasets (cost avoided by HELPERS_BAKE_DATASETS)
+
+void bm_dataset_generation(bench::State& state)
+{
+    std::vector<int> data(static_cast<size_t>(state.range(0)));
+    uint32_t seed = 0;
+
+    for (auto _ : state)
+    {
+        helpers::fill_numeric_dataset(data, {.seed = ++seed});
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+BENCHMARK(bm_dataset_generation)->arg(1 << 20);
@@ -0,0 +1,75 @@
+#include <benchmark.hpp>
+#include <task_resumer.hpp>
+
+#include <coroutine>
+#include <cstdint>
+
+// TaskResumer of the coroutines module - cost of suspension & resumption of a coroutine
+TaskResumer count_up(int max)
+{
+    for (int value = 1; value <= max; ++value)
+        co_await std::suspend_always{};
+
+    co_return max;
+}
+
+TaskResumer finished()
+{
+    co_return 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+// resumption of a suspended coroutine vs a loop
+
+void bm_task_resumer_resume(bench::State& state)
+{
+    const int64_t count = state.range(0);
+
+    for (auto _ : state)
+    {
+        TaskResumer task = count_up(static_cast<int>(count));
+        int64_t resumes = 0;
+        while (task.resume())
+            ++resumes;
+        bench::DoNotOptimize(resumes);
+        bench::DoNotOptimize(task.get_value());
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations()) * count);
+}
+
+void bm_plain_loop(bench::State& state)
+{
+    int64_t count = state.range(0);
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(count);
+        int64_t sum = 0;
+        for (int64_t i = 0; i < count; ++i)
+        {
+            sum += i;
+            bench::ClobberMemory(); // not replaced with a closed formula
+        }
+        bench::DoNotOptimize(sum);
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations()) * count);
+}
+
+BENCHMARK(bm_task_resumer_resume)->arg(1 << 16);
+BENCHMARK(bm_plain_loop)->arg(1 << 16);
+
+////////////////////////////////////////////////////////////////////////
+// creation & destruction of a coroutine frame (heap allocation unless elided)
+
+void bm_coroutine_frame(bench::State& state)
+{
+    for (auto _ : state)
+    {
+        TaskResumer task = finished();
+        bench::DoNotOptimize(task.resume());
+    }
+}
+
+BENCHMARK(bm_coroutine_frame);
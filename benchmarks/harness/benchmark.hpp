@@ -0,0 +1,602 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <ostream>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace bench
+{
+    /*********************
+    Micro-benchmark harness - header-only, no dependencies (API modeled on Google Benchmark)
+    - BENCHMARK(function)->arg(n) registers void function(bench::State&) - run once for each argument set
+      (range(lo, hi) - lo multiplied by 8 up to hi, dense_range(lo, hi, step))
+    - for (auto _ : state) { ... } - timed loop; state.range(i) - arguments, set_items_processed()/set_bytes_processed()
+      - throughput, pause_timing()/resume_timing() - excluded setup inside the loop
+    - each benchmark is warmed up, then the number of iterations is chosen so that a repetition lasts at least
+      --min-time; time per iteration of --repetitions runs gives mean, median, stddev, min, max & cv
+    - DoNotOptimize(value) - value is treated as used (computation is not removed),
+      ClobberMemory() - all pending writes to memory are treated as observed
+    - command line: --filter=<regex> --min-time=<s> --warmup=<s> --repetitions=<n> --json=<file> --list
+    - JSON report is compared with benchmarks/compare.py
+    **********************/
+
+    ////////////////////////////////////////////////////////////////////////
+    // optimization barriers
+
+    namespace Details
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        __declspec(noinline) inline void use_char_pointer(const volatile char*) { }
+#endif
+    } // namespace Details
+
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        Details::use_char_pointer(&reinterpret_cast<const volatile char&>(value));
+        _ReadWriteBarrier();
+#endif
+    }
+
+    // value may be modified - computations using it cannot be hoisted out of the loop
+    template <typename T>
+    inline void DoNotOptimize(T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(void*))
+#if defined(__clang__)
+            asm volatile("" : "+r,m"(value) : : "memory");
+#else
+            asm volatile("" : "+m,r"(value) : : "memory"); // GCC - "+r,m" fails for some types (e.g. float)
+#endif
+        else
+            asm volatile("" : "+m"(value) : : "memory");
+#else
+        Details::use_char_pointer(&reinterpret_cast<const volatile char&>(value));
+        _ReadWriteBarrier();
+#endif
+    }
+
+    inline void ClobberMemory()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#else
+        _ReadWriteBarrier();
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // State - timed loop of a single run
+
+    using Clock = std::chrono::steady_clock;
+
+    class State
+    {
+        uint64_t iterations_;
+        std::vector<int64_t> args_;
+        Clock::time_point start_{};
+        Clock::duration elapsed_{};
+        bool running_ = false;
+        int64_t items_processed_ = 0;
+        int64_t bytes_processed_ = 0;
+
+        void start_timing()
+        {
+            running_ = true;
+            start_ = Clock::now();
+        }
+
+        void stop_timing()
+        {
+            if (running_)
+                elapsed_ += Clock::now() - start_;
+            running_ = false;
+        }
+
+    public:
+        struct [[maybe_unused]] Value // no warnings for the unused loop variable
+        {
+        };
+
+        class Iterator
+        {
+            State* state_;
+            uint64_t remaining_;
+
+        public:
+            Iterator(State* state, uint64_t remaining) noexcept
+                : state_{state}
+                , remaining_{remaining}
+            {
+            }
+
+            Value operator*() const noexcept { return {}; }
+
+            Iterator& operator++() noexcept
+            {
+                --remaining_;
+                return *this;
+            }
+
+            bool operator!=(const Iterator&) noexcept
+            {
+                if (remaining_ != 0) [[likely]]
+                    return true;
+                state_->stop_timing();
+                return false;
+            }
+        };
+
+        State(uint64_t iterations, std::vector<int64_t> args)
+            : iterations_{iterations}
+            , args_{std::move(args)}
+        {
+        }
+
+        Iterator begin()
+        {
+            start_timing();
+            return Iterator{this, iterations_};
+        }
+
+        Iterator end() noexcept { return Iterator{this, 0}; }
+
+        int64_t range(size_t index = 0) const { return args_.at(index); }
+        uint64_t iterations() const noexcept { return iterations_; }
+
+        void pause_timing() { stop_timing(); }
+        void resume_timing() { start_timing(); }
+
+        // totals for all iterations
+        void set_items_processed(int64_t items) noexcept { items_processed_ = items; }
+        void set_bytes_processed(int64_t bytes) noexcept { bytes_processed_ = bytes; }
+
+        double elapsed_seconds() const { return std::chrono::duration<double>(elapsed_).count(); }
+        int64_t items_processed() const noexcept { return items_processed_; }
+        int64_t bytes_processed() const noexcept { return bytes_processed_; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////
+    // registration
+
+    using Function = std::function<void(State&)>;
+
+    class Benchmark
+    {
+        std::string name_;
+        Function function_;
+        std::vector<std::vector<int64_t>> args_;
+
+    public:
+        Benchmark(std::string name, Function function)
+            : name_{std::move(name)}
+            , function_{std::move(function)}
+        {
+        }
+
+        Benchmark* arg(int64_t value)
+        {
+            args_.push_back({value});
+            return this;
+        }
+
+        Benchmark* args(std::initializer_list<int64_t> values)
+        {
+            args_.emplace_back(values);
+            return this;
+        }
+
+        // first, first * multiplier, ... - last (like in Google Benchmark 0 is followed by 1)
+        Benchmark* range(int64_t first, int64_t last, int64_t multiplier = 8)
+        {
+            assert(multiplier > 1 && 0 <= first && first <= last);
+
+            arg(first);
+
+            int64_t value = std::max<int64_t>(first, 1);
+            if (value != first && value < last)
+                arg(value);
+
+            while (value <= last / multiplier)
+            {
+                value *= multiplier;
+                if (value < last)
+                    arg(value);
+            }
+
+            return first < last ? arg(last) : this;
+        }
+
+        Benchmark* dense_range(int64_t first, int64_t last, int64_t step = 1)
+        {
+            assert(step > 0);
+
+            for (int64_t value = first; value <= last; value += step)
+                arg(value);
+            return this;
+        }
+
+        const std::string& name() const noexcept { return name_; }
+        const Function& function() const noexcept { return function_; }
+
+        // at least one (empty) argument set
+        std::vector<std::vector<int64_t>> argument_sets() const
+        {
+            return args_.empty() ? std::vector<std::vector<int64_t>>{{}} : args_;
+        }
+    };
+
+    inline std::vector<std::unique_ptr<Benchmark>>& registry()
+    {
+        static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+        return benchmarks;
+    }
+
+    inline Benchmark* register_benchmark(std::string name, Function function)
+    {
+        return registry().emplace_back(std::make_unique<Benchmark>(std::move(name), std::move(function))).get();
+    }
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+#define BENCHMARK(function) \
+    [[maybe_unused]] static ::bench::Benchmark* BENCH_CONCAT(bench_registration_, __LINE__) = ::bench::register_benchmark(#function, function)
+
+    ////////////////////////////////////////////////////////////////////////
+    // statistics
+
+    struct Statistics
+    {
+        double mean = 0.0;
+        double median = 0.0;
+        double stddev = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        double cv = 0.0; // stddev / mean
+    };
+
+    inline Statistics compute_statistics(std::vector<double> samples)
+    {
+        Statistics stats;
+        if (samples.empty())
+            return stats;
+
+        std::ranges::sort(samples);
+        const size_t n = samples.size();
+
+        stats.min = samples.front();
+        stats.max = samples.back();
+        stats.median = n % 2 == 1 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2.0;
+        stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(n);
+
+        if (n > 1)
+        {
+            const double sum_sq = std::accumulate(samples.begin(), samples.end(), 0.0, [&](double acc, double x) { return acc + (x - stats.mean) * (x - stats.mean); });
+            stats.stddev = std::sqrt(sum_sq / static_cast<double>(n - 1));
+        }
+
+        stats.cv = stats.mean > 0.0 ? stats.stddev / stats.mean : 0.0;
+
+        return stats;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // runner
+
+    struct Options
+    {
+        std::string filter = ".*";
+        double min_time = 0.1; // seconds per repetition
+        double warmup = 0.05;  // seconds
+        size_t repetitions = 5;
+        std::string json_file;
+        bool list = false;
+    };
+
+    struct Result
+    {
+        std::string name;
+        uint64_t iterations = 0;
+        std::vector<double> samples; // ns per iteration
+        Statistics stats;
+        double items_per_second = 0.0;
+        double bytes_per_second = 0.0;
+    };
+
+    namespace Details
+    {
+        inline std::string full_name(const std::string& name, const std::vector<int64_t>& args)
+        {
+            std::string result = name;
+            for (int64_t arg : args)
+                result += "/" + std::to_string(arg);
+            return result;
+        }
+
+        inline State run_once(const Benchmark& benchmark, const std::vector<int64_t>& args, uint64_t iterations)
+        {
+            State state{iterations, args};
+            benchmark.function()(state);
+            return state;
+        }
+
+        // iterations for a run of at least min_time seconds - extrapolated from runs of growing length
+        inline uint64_t calibrate(const Benchmark& benchmark, const std::vector<int64_t>& args, double min_time, double warmup)
+        {
+            constexpr uint64_t max_iterations = 1'000'000'000;
+
+            uint64_t iterations = 1;
+            double warmup_elapsed = 0.0;
+
+            while (true)
+            {
+                const double elapsed = run_once(benchmark, args, iterations).elapsed_seconds();
+                warmup_elapsed += elapsed;
+
+                if ((elapsed >= min_time && warmup_elapsed >= warmup) || iterations >= max_iterations)
+                    return iterations;
+
+                if (elapsed >= min_time) // warmup is not finished yet - the same length
+                    continue;
+
+                const double multiplier = elapsed > 0.0 ? std::clamp(1.4 * min_time / elapsed, 2.0, 10.0) : 10.0;
+                iterations = std::min(max_iterations, static_cast<uint64_t>(static_cast<double>(iterations) * multiplier));
+            }
+        }
+
+        inline std::string escape_json(std::string_view text)
+        {
+            std::string result;
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                    result += '\\';
+                result += c;
+            }
+            return result;
+        }
+
+        inline std::string format_time(double ns)
+        {
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(ns < 10.0 ? 2 : 1);
+            if (ns < 1e3)
+                out << ns << " ns";
+            else if (ns < 1e6)
+                out << ns / 1e3 << " us";
+            else if (ns < 1e9)
+                out << ns / 1e6 << " ms";
+            else
+                out << ns / 1e9 << " s";
+            return out.str();
+        }
+
+        // unit - "B" for bytes, empty for items
+        inline std::string format_rate(double per_second, std::string_view unit)
+        {
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(1);
+            if (per_second >= 1e9)
+                out << per_second / 1e9 << "G";
+            else if (per_second >= 1e6)
+                out << per_second / 1e6 << "M";
+            else if (per_second >= 1e3)
+                out << per_second / 1e3 << "k";
+            else
+                out << per_second;
+            out << unit << "/s";
+            return out.str();
+        }
+    } // namespace Details
+
+    inline Result run_benchmark(const Benchmark& benchmark, const std::vector<int64_t>& args, const Options& options)
+    {
+        Result result;
+        result.name = Details::full_name(benchmark.name(), args);
+        result.iterations = Details::calibrate(benchmark, args, options.min_time, options.warmup);
+
+        double total_seconds = 0.0;
+        int64_t total_items = 0;
+        int64_t total_bytes = 0;
+
+        for (size_t rep = 0; rep < std::max<size_t>(options.repetitions, 1); ++rep)
+        {
+            const State state = Details::run_once(benchmark, args, result.iterations);
+            result.samples.push_back(state.elapsed_seconds() * 1e9 / static_cast<double>(result.iterations));
+            total_seconds += state.elapsed_seconds();
+            total_items += state.items_processed();
+            total_bytes += state.bytes_processed();
+        }
+
+        result.stats = compute_statistics(result.samples);
+        if (total_seconds > 0.0)
+        {
+            result.items_per_second = static_cast<double>(total_items) / total_seconds;
+            result.bytes_per_second = static_cast<double>(total_bytes) / total_seconds;
+        }
+
+        return result;
+    }
+
+    inline void print_header(std::ostream& out)
+    {
+        out << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(12) << "Iterations" << std::setw(14) << "Median"
+            << std::setw(14) << "Mean" << std::setw(14) << "StdDev" << std::setw(8) << "CV" << std::setw(14) << "Throughput" << "\n"
+            << std::string(124, '-') << "\n";
+    }
+
+    inline void print_result(std::ostream& out, const Result& result)
+    {
+        std::string throughput;
+        if (result.bytes_per_second > 0.0)
+            throughput = Details::format_rate(result.bytes_per_second, "B");
+        else if (result.items_per_second > 0.0)
+            throughput = Details::format_rate(result.items_per_second, "");
+
+        std::ostringstream cv;
+        cv << std::fixed << std::setprecision(1) << result.stats.cv * 100.0 << "%";
+
+        out << std::left << std::setw(48) << result.name << std::right << std::setw(12) << result.iterations << std::setw(14)
+            << Details::format_time(result.stats.median) << std::setw(14) << Details::format_time(result.stats.mean) << std::setw(14)
+            << Details::format_time(result.stats.stddev) << std::setw(8) << cv.str() << std::setw(14) << throughput << std::endl;
+    }
+
+    inline void write_json(std::ostream& out, const std::vector<Result>& results, std::string_view executable)
+    {
+        const std::time_t now = std::time(nullptr);
+        char date[32]{};
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        out << std::setprecision(17);
+        out << "{\n";
+        out << "  \"context\": {\n";
+        out << "    \"executable\": \"" << Details::escape_json(executable) << "\",\n";
+        out << "    \"date\": \"" << date << "\",\n";
+        out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+        out << "    \"build_type\": \"release\",\n";
+#else
+        out << "    \"build_type\": \"debug\",\n";
+#endif
+        out << "    \"time_unit\": \"ns\"\n";
+        out << "  },\n";
+        out << "  \"benchmarks\": [";
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << "    {\n";
+            out << "      \"name\": \"" << Details::escape_json(r.name) << "\",\n";
+            out << "      \"iterations\": " << r.iterations << ",\n";
+            out << "      \"repetitions\": " << r.samples.size() << ",\n";
+            out << "      \"mean\": " << r.stats.mean << ",\n";
+            out << "      \"median\": " << r.stats.median << ",\n";
+            out << "      \"stddev\": " << r.stats.stddev << ",\n";
+            out << "      \"min\": " << r.stats.min << ",\n";
+            out << "      \"max\": " << r.stats.max << ",\n";
+            out << "      \"cv\": " << r.stats.cv << ",\n";
+            out << "      \"items_per_second\": " << r.items_per_second << ",\n";
+            out << "      \"bytes_per_second\": " << r.bytes_per_second << ",\n";
+            out << "      \"samples\": [";
+            for (size_t s = 0; s < r.samples.size(); ++s)
+                out << (s == 0 ? "" : ", ") << r.samples[s];
+            out << "]\n";
+            out << "    }";
+        }
+
+        out << "\n  ]\n}\n";
+    }
+
+    inline Options parse_options(int argc, char** argv)
+    {
+        Options options;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            auto value_of = [arg](std::string_view option) { return std::string{arg.substr(option.size())}; };
+
+            if (arg.starts_with("--filter="))
+                options.filter = value_of("--filter=");
+            else if (arg.starts_with("--min-time="))
+                options.min_time = std::stod(value_of("--min-time="));
+            else if (arg.starts_with("--warmup="))
+                options.warmup = std::stod(value_of("--warmup="));
+            else if (arg.starts_with("--repetitions="))
+                options.repetitions = std::stoul(value_of("--repetitions="));
+            else if (arg.starts_with("--json="))
+                options.json_file = value_of("--json=");
+            else if (arg == "--list")
+                options.list = true;
+            else
+                throw std::invalid_argument("unknown option: " + std::string{arg});
+        }
+
+        return options;
+    }
+
+    inline int run(int argc, char** argv)
+    {
+        Options options;
+        std::regex filter;
+        try
+        {
+            options = parse_options(argc, argv);
+            filter = std::regex{options.filter};
+        }
+        catch (const std::exception& e) // std::regex_error for an invalid --filter
+        {
+            std::cerr << e.what() << "\n"
+                      << "usage: " << argv[0] << " [--filter=<regex>] [--min-time=<s>] [--warmup=<s>] [--repetitions=<n>] [--json=<file>] [--list]\n";
+            return 2;
+        }
+
+        std::vector<Result> results;
+        if (!options.list)
+            print_header(std::cout);
+
+        for (const auto& benchmark : registry())
+        {
+            for (const auto& args : benchmark->argument_sets())
+            {
+                const std::string name = Details::full_name(benchmark->name(), args);
+                if (!std::regex_search(name, filter))
+                    continue;
+
+                if (options.list)
+                {
+                    std::cout << name << "\n";
+                    continue;
+                }
+
+                results.push_back(run_benchmark(*benchmark, args, options));
+                print_result(std::cout, results.back());
+            }
+        }
+
+        if (!options.json_file.empty())
+        {
+            std::ofstream json{options.json_file};
+            if (!json)
+            {
+                std::cerr << "cannot write " << options.json_file << "\n";
+                return 1;
+            }
+            write_json(json, results, argv[0]);
+        }
+
+        return 0;
+    }
+} // namespace bench
+
+#endif
@@ -0,0 +1,127 @@
+#include <algorithms.hpp>
+#include <benchmark.hpp>
+#include <bits.hpp>
+#include <flat_map.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////
+// hash maps - lookups of existing & missing keys
+
+template <typename TMap>
+void bm_map_find(bench::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    std::mt19937_64 rnd_gen{665};
+    std::vector<uint64_t> keys(size);
+    std::ranges::generate(keys, rnd_gen);
+
+    TMap map;
+    for (uint64_t key : keys)
+        map.insert({key, key});
+
+    std::vector<uint64_t> lookups(keys.begin(), keys.end());
+    std::ranges::generate(lookups.begin() + size / 2, lookups.end(), rnd_gen); // half of the keys are missing
+    std::ranges::shuffle(lookups, rnd_gen);
+
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (uint64_t key : lookups)
+            found += map.find(key) != map.end();
+        bench::DoNotOptimize(found);
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * size));
+}
+
+void bm_map_find_std_unordered_map(bench::State& state)
+{
+    bm_map_find<std::unordered_map<uint64_t, uint64_t>>(state);
+}
+
+void bm_map_find_flat_hash_map(bench::State& state)
+{
+    bm_map_find<helpers::FlatHashMap<uint64_t, uint64_t>>(state);
+}
+
+BENCHMARK(bm_map_find_std_unordered_map)->range(1 << 10, 1 << 20, 32);
+BENCHMARK(bm_map_find_flat_hash_map)->range(1 << 10, 1 << 20, 32);
+
+////////////////////////////////////////////////////////////////////////
+// bits - counting set bits of std::vector<bool> bit by bit & word by word
+
+std::vector<bool> random_bits(size_t size)
+{
+    std::mt19937 rnd_gen{42};
+    std::vector<bool> bits(size);
+    for (size_t i = 0; i < size; ++i)
+        bits[i] = rnd_gen() % 2 == 0;
+    return bits;
+}
+
+void bm_count_bits_std_count(bench::State& state)
+{
+    const std::vector<bool> bits = random_bits(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(bits);
+        bench::DoNotOptimize(std::count(bits.begin(), bits.end(), true));
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * bits.size()));
+}
+
+void bm_count_bits_helpers_count(bench::State& state)
+{
+    const std::vector<bool> bits = random_bits(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(bits);
+        bench::DoNotOptimize(helpers::bits::count(bits, true));
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * bits.size()));
+}
+
+BENCHMARK(bm_count_bits_std_count)->arg(1 << 20);
+BENCHMARK(bm_count_bits_helpers_count)->arg(1 << 20);
+
+////////////////////////////////////////////////////////////////////////
+// sum - independent partial sums
+
+void bm_sum_std_accumulate(bench::State& state)
+{
+    std::vector<float> data(static_cast<size_t>(state.range(0)), 0.5f);
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(data);
+        bench::DoNotOptimize(std::accumulate(data.begin(), data.end(), 0.0f));
+    }
+
+    state.set_bytes_processed(static_cast<int64_t>(state.iterations() * data.size() * sizeof(float)));
+}
+
+void bm_sum_algorithms_sum(bench::State& state)
+{
+    std::vector<float> data(static_cast<size_t>(state.range(0)), 0.5f);
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(data);
+        bench::DoNotOptimize(helpers::algorithms::sum(data));
+    }
+
+    state.set_bytes_processed(static_cast<int64_t>(state.iterations() * data.size() * sizeof(float)));
+}
+
+BENCHMARK(bm_sum_std_accumulate)->arg(1 << 12)->arg(1 << 22);
+BENCHMARK(bm_sum_algorithms_sum)->arg(1 << 12)->arg(1 << 22);
@@ -0,0 +1,179 @@
+#include <benchmark.hpp>
+#include <small_sort.hpp>
+#include <static_string.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+std::vector<int> random_ints(size_t size, uint32_t seed = 665)
+{
+    std::mt19937 rnd_gen{seed};
+    std::vector<int> data(size);
+    std::ranges::generate(data, [&] { return static_cast<int>(rnd_gen()); });
+    return data;
+}
+
+////////////////////////////////////////////////////////////////////////
+// views pipeline vs hand written loop
+
+void bm_sum_of_even_squares_views(bench::State& state)
+{
+    const std::vector<int> data = random_ints(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        int64_t sum = 0;
+        for (int64_t x : data | std::views::filter([](int x) { return x % 2 == 0; }) | std::views::transform([](int x) { return int64_t{x} * x; }))
+            sum += x;
+        bench::DoNotOptimize(sum);
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+void bm_sum_of_even_squares_loop(bench::State& state)
+{
+    const std::vector<int> data = random_ints(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        int64_t sum = 0;
+        for (int x : data)
+            if (x % 2 == 0)
+                sum += int64_t{x} * x;
+        bench::DoNotOptimize(sum);
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+BENCHMARK(bm_sum_of_even_squares_views)->arg(1 << 20);
+BENCHMARK(bm_sum_of_even_squares_loop)->arg(1 << 20);
+
+////////////////////////////////////////////////////////////////////////
+// sorting of small arrays - 1M items sorted in arrays of N
+
+template <size_t N>
+void bm_small_arrays_std_sort(bench::State& state)
+{
+    const std::vector<int> source = random_ints(1 << 20);
+    std::vector<int> data(source.size());
+
+    for (auto _ : state)
+    {
+        state.pause_timing();
+        std::ranges::copy(source, data.begin());
+        state.resume_timing();
+
+        for (size_t i = 0; i + N <= data.size(); i += N)
+            std::sort(data.begin() + i, data.begin() + i + N);
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+template <size_t N>
+void bm_small_arrays_small_sort(bench::State& state)
+{
+    const std::vector<int> source = random_ints(1 << 20);
+    std::vector<int> data(source.size());
+
+    for (auto _ : state)
+    {
+        state.pause_timing();
+        std::ranges::copy(source, data.begin());
+        state.resume_timing();
+
+        for (size_t i = 0; i + N <= data.size(); i += N)
+            helpers::small_sort(std::span<int, N>{data.data() + i, N});
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+BENCHMARK(bm_small_arrays_std_sort<8>);
+BENCHMARK(bm_small_arrays_small_sort<8>);
+BENCHMARK(bm_small_arrays_std_sort<32>);
+BENCHMARK(bm_small_arrays_small_sort<32>);
+
+////////////////////////////////////////////////////////////////////////
+// sorting with sorting networks for leaf partitions
+
+void bm_sort_std_sort(bench::State& state)
+{
+    const std::vector<int> source = random_ints(static_cast<size_t>(state.range(0)));
+    std::vector<int> data(source.size());
+
+    for (auto _ : state)
+    {
+        state.pause_timing();
+        std::ranges::copy(source, data.begin());
+        state.resume_timing();
+
+        std::sort(data.begin(), data.end());
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+void bm_sort_hybrid_sort(bench::State& state)
+{
+    const std::vector<int> source = random_ints(static_cast<size_t>(state.range(0)));
+    std::vector<int> data(source.size());
+
+    for (auto _ : state)
+    {
+        state.pause_timing();
+        std::ranges::copy(source, data.begin());
+        state.resume_timing();
+
+        helpers::hybrid_sort(data);
+        bench::ClobberMemory();
+    }
+
+    state.set_items_processed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+BENCHMARK(bm_sort_std_sort)->range(1 << 10, 1 << 22, 64);
+BENCHMARK(bm_sort_hybrid_sort)->range(1 << 10, 1 << 22, 64);
+
+////////////////////////////////////////////////////////////////////////
+// tokens of literals - parsed by the compiler vs std::views::split at runtime
+
+void bm_tokenize_views_split(bench::State& state)
+{
+    std::string_view text = "api/v1/users/:id/orders/:order_id";
+
+    for (auto _ : state)
+    {
+        bench::DoNotOptimize(text);
+
+        size_t total_length = 0;
+        for (auto&& token : text | std::views::split('/'))
+            total_length += std::ranges::distance(token);
+        bench::DoNotOptimize(total_length);
+    }
+}
+
+void bm_tokenize_compile_time(bench::State& state)
+{
+    for (auto _ : state)
+    {
+        size_t total_length = 0;
+        for (std::string_view token : helpers::tokens<"api/v1/users/:id/orders/:order_id", '/'>)
+            total_length += token.size();
+        bench::DoNotOptimize(total_length);
+    }
+}
+
+BENCHMARK(bm_tokenize_views_split);
+BENCHMARK(bm_tokenize_compile_time);
@@ -0,0 +1,127 @@
+#include <algorithms.hpp>
+#include <benchmark.hpp>
+#include <md_span.hpp>
+#include <serialization.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <sstream>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////
+// fill - buffers larger than the cache are written with streaming stores
+
+void bm_fill_std_fill(bench::State& state)
+{
+    std::vector<int32_t> data(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        std::fill(data.begin(), data.end(), 42);
+        bench::ClobberMemory();
+    }
+
+    state.set_bytes_processed(static_cast<int64_t>(state.iterations() * data.size() * sizeof(int32_t)));
+}
+
+void bm_fill_algorithms_fill(bench::State& state)
+{
+    std::vector<int32_t> data(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        helpers::algorithms::fill(data, 42);
+        bench::ClobberMemory();
+    }
+
+    state.set_bytes_processed(static_cast<int64_t>(state.iterations() * data.size() * sizeof(int32_t)));
+}
+
+BENCHMARK(bm_fill_std_fill)->arg(1 << 16)->arg(1 << 24);
+BENCHMARK(bm_fill_algorithms_fill)->arg(1 << 16)->arg(1 << 24);
+
+////////////////////////////////////////////////////////////////////////
+// transpose of a square matrix - row by row vs cache-blocked
+
+void bm_transpose_naive(bench::State& state)
+{
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    std::vector<float> src_buffer(n * n);
+    std::vector<float> dest_buffer(n * n);
+    std::iota(src_buffer.begin(), src_buffer.end(), 0.0f);
+
+    helpers::MdSpan src{std::span{src_buffer}, n, n};
+    helpers::MdSpan dest{std::span{dest_buffer}, n, n};
+
+    for (auto _ : state)
+    {
+        for (size_t row = 0; row < n; ++row)
+            for (size_t col = 0; col < n; ++col)
+                dest[col, row] = src[row, col];
+        bench::ClobberMemory();
+    }
+
+    state.set_bytes_processed(static_cast<int64_t>(state.iterations() * n * n * sizeof(float)));
+}
+
+void bm_transpose_blocked(bench::State& state)
+{
+    const size_t n = static_cast<size_t>(state.range(0));
+
+    std::vector<float> src_buffer(n * n);
+    std::vector<float> dest_buffer(n * n);
+    std::iota(src_buffer.begin(), src_buffer.end(), 0.0f);
+
+    helpers::MdSpan src{std::span{src_buffer}, n, n};
+    helpers::MdSpan dest{std::span{dest_buffer}, n, n};
+
+    for (auto _ : state)
+    {
+        helpers::for_each_index_blocked(n, n, 64, [&](size_t row, size_t col) { dest[col, row] = src[row, col]; });
+        bench::ClobberMemory();
+    }
+
+    state.set_bytes_processed(static_cast<int64_t>(state.iterations() * n * n * sizeof(float)));
+}
+
+BENCHMARK(bm_transpose_naive)->arg(256)->arg(4096);
+BENCHMARK(bm_transpose_blocked)->arg(256)->arg(4096);
+
+////////////////////////////////////////////////////////////////////////
+// binary serialization - iostream vs spans of bytes
+
+void bm_serialize_ostream_write(bench::State& state)
+{
+    std::vector<double> values(static_cast<size_t>(state.range(0)), 3.14);
+
+    for (auto _ : state)
+    {
+        std::ostringstream out;
+        out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(double)));
+        bench::DoNotOptimize(out);
+    }
+
+    state.set_bytes_processed(static_cast<int64_t>(state.iterations() * values.size() * sizeof(double)));
+}
+
+void bm_serialize_binary_writer(bench::State& state)
+{
+    std::vector<double> values(static_cast<size_t>(state.range(0)), 3.14);
+    std::vector<std::byte> buffer(values.size() * sizeof(double));
+
+    for (auto _ : state)
+    {
+        helpers::BinaryWriter writer{buffer};
+        writer.write(std::span{values});
+        bench::ClobberMemory();
+    }
+
+    state.set_bytes_processed(static_cast<int64_t>(state.iterations() * values.size() * sizeof(double)));
+}
+
+BENCHMARK(bm_serialize_ostream_write)->arg(1 << 20);
+BENCHMARK(bm_serialize_binary_writer)->arg(1 << 20);
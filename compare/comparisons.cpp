@@ -1,7 +1,25 @@
+#include <lexicographical_compare.hpp>
+#include <radix_sort.hpp>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <list>
+#include <memory_resource>
+#include <new>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -31,6 +49,8 @@ struct Point
 
     bool operator==(const Point&) const = default;
 
+    auto operator<=>(const Point&) const = default; // lexicographic - x, y
+
     // bool operator==(const Point& other) const
     // {
     //     return x == other.x && y == other.y;
@@ -59,6 +79,8 @@ struct Point3D : Point
     }
 
     bool operator==(const Point3D&) const = default;
+
+    auto operator<=>(const Point3D&) const = default; // base first - x, y, z
 };
 
 TEST_CASE("Point - operator ==")
@@ -92,15 +114,50 @@ TEST_CASE("Point - operator ==")
 
 namespace Comparisons
 {
+    namespace Details
+    {
+        constexpr int64_t checked_add(int64_t a, int64_t b)
+        {
+            if ((b > 0 && a > std::numeric_limits<int64_t>::max() - b) || (b < 0 && a < std::numeric_limits<int64_t>::min() - b))
+                throw std::overflow_error("Money overflow");
+
+            return a + b;
+        }
+
+        constexpr int64_t checked_mul(int64_t a, int64_t b)
+        {
+            constexpr int64_t max = std::numeric_limits<int64_t>::max();
+            constexpr int64_t min = std::numeric_limits<int64_t>::min();
 
-    struct Money
+            // bounds of b are swapped for a negative a (min / -1 overflows itself)
+            const bool overflow = (a > 0 && (b > max / a || b < min / a))
+                || (a == -1 && b == min)
+                || (a < -1 && (b < max / a || b > min / a));
+
+            if (overflow)
+                throw std::overflow_error("Money overflow");
+
+            return a * b;
+        }
+    } // namespace Details
+
+    // fixed-point amount - 1 unit == 1 cent
+    class Money
     {
-        int dollars;
-        int cents;
+        int64_t cents_;
 
-        constexpr Money(int dollars, int cents)
-            : dollars(dollars)
-            , cents(cents)
+        struct FromCents
+        {
+        };
+
+        constexpr Money(FromCents, int64_t cents) noexcept
+            : cents_{cents}
+        {
+        }
+
+    public:
+        constexpr Money(int64_t dollars, int cents)
+            : cents_{Details::checked_add(Details::checked_mul(dollars, 100), cents)}
         {
             if (cents < 0 || cents > 99)
             {
@@ -109,30 +166,157 @@ namespace Comparisons
         }
 
         constexpr Money(double amount)
-            : dollars(static_cast<int>(amount))
-            , cents(static_cast<int>(amount * 100) % 100)
+            : cents_{static_cast<int64_t>(amount) * 100 + static_cast<int64_t>(amount * 100) % 100}
+        {
+        }
+
+        static constexpr Money from_cents(int64_t cents) noexcept
+        {
+            return Money{FromCents{}, cents};
+        }
+
+        constexpr int64_t in_cents() const noexcept { return cents_; }
+        // floor division - cents are always in [0, 99] like in the constructor: -0.50 is Money{-1, 50}
+        constexpr int64_t dollars() const noexcept { return cents_ / 100 - (cents_ % 100 < 0); }
+        constexpr int cents() const noexcept { return static_cast<int>((cents_ % 100 + 100) % 100); }
+
+        constexpr Money& operator+=(const Money& other)
         {
+            cents_ = Details::checked_add(cents_, other.cents_);
+            return *this;
+        }
+
+        constexpr friend Money operator+(Money a, const Money& b)
+        {
+            return a += b;
+        }
+
+        constexpr Money operator-() const
+        {
+            return Money{FromCents{}, Details::checked_mul(cents_, -1)};
         }
 
         friend std::ostream& operator<<(std::ostream& out, const Money& m)
         {
-            return out << std::format("${}.{}", m.dollars, m.cents);
+            return out << std::format("${}.{}", m.dollars(), m.cents());
         }
 
         // bool operator==(const Money&) const = default; // implicitly declared
 
         auto operator<=>(const Money&) const = default;
+
+        friend auto radix_members(const Money& m) noexcept
+        {
+            return std::tie(m.cents_);
+        }
     };
 
+    static_assert(sizeof(Money) == sizeof(int64_t));
+
     namespace Literals
     {
         // clang-format off
         constexpr Money operator""_USD(long double amount)
         {
-            return Money(amount);
+            return Money(static_cast<double>(amount));
         }
         // clang-format on
     } // namespace Literals
+
+    /*********************
+    Ledger - bulk operations on spans of Money
+    - loops work on several independent lanes of int64_t - they are vectorized by the compiler
+    - overflows are detected (std::overflow_error) without branches in the hot loop
+    **********************/
+    namespace Ledger
+    {
+        constexpr size_t lanes = 8;
+
+        // sum of amounts - throws std::overflow_error if the running sum overflows
+        inline Money sum(std::span<const Money> amounts)
+        {
+            std::array<int64_t, lanes> partial_sums{};
+            int64_t overflow = 0; // sign bit is set if any lane overflowed
+
+            size_t i = 0;
+            for (; i + lanes <= amounts.size(); i += lanes)
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    const int64_t a = partial_sums[lane];
+                    const int64_t b = amounts[i + lane].in_cents();
+                    const auto result = static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b)); // wraps
+                    overflow |= (a ^ result) & (b ^ result);
+                    partial_sums[lane] = result;
+                }
+
+            int64_t total = 0;
+
+            if (overflow < 0) // partial sums are not exact - amounts are added again in order
+                i = 0;
+            else
+                for (int64_t partial_sum : partial_sums)
+                    total = Details::checked_add(total, partial_sum);
+
+            for (; i < amounts.size(); ++i)
+                total = Details::checked_add(total, amounts[i].in_cents());
+
+            return Money::from_cents(total);
+        }
+
+        // throws std::invalid_argument for empty span
+        inline std::pair<Money, Money> minmax(std::span<const Money> amounts)
+        {
+            if (amounts.empty())
+                throw std::invalid_argument("minmax of empty range");
+
+            std::array<int64_t, lanes> mins, maxs;
+            mins.fill(amounts.front().in_cents());
+            maxs.fill(amounts.front().in_cents());
+
+            size_t i = 0;
+            for (; i + lanes <= amounts.size(); i += lanes)
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    mins[lane] = std::min(mins[lane], amounts[i + lane].in_cents());
+                    maxs[lane] = std::max(maxs[lane], amounts[i + lane].in_cents());
+                }
+
+            int64_t min = std::ranges::min(mins);
+            int64_t max = std::ranges::max(maxs);
+            for (; i < amounts.size(); ++i)
+            {
+                min = std::min(min, amounts[i].in_cents());
+                max = std::max(max, amounts[i].in_cents());
+            }
+
+            return {Money::from_cents(min), Money::from_cents(max)};
+        }
+
+        inline void sort(std::span<Money> amounts)
+        {
+            helpers::radix_sort(amounts);
+        }
+
+        // counts[b] - number of amounts in [upper_bounds[b-1], upper_bounds[b]) (upper_bounds must be sorted)
+        inline std::vector<size_t> bucket_counts(std::span<const Money> amounts, std::span<const Money> upper_bounds)
+        {
+            assert(std::ranges::is_sorted(upper_bounds));
+
+            std::vector<int64_t> bounds(upper_bounds.size());
+            std::ranges::transform(upper_bounds, bounds.begin(), &Money::in_cents);
+
+            std::vector<size_t> counts(bounds.size() + 1);
+            for (const Money& amount : amounts)
+            {
+                size_t bucket = 0;
+                for (int64_t bound : bounds)
+                    bucket += amount.in_cents() >= bound;
+                ++counts[bucket];
+            }
+
+            return counts;
+        }
+    } // namespace Ledger
 } // namespace Comparisons
 
 TEST_CASE("Money - operator <=>")
@@ -165,6 +349,257 @@ TEST_CASE("Money - operator <=>")
     }
 }
 
+TEST_CASE("Money - fixed point")
+{
+    using Comparisons::Money;
+    using namespace Comparisons::Literals;
+
+    CHECK(Money{42, 50}.in_cents() == 4250);
+    CHECK(Money{42, 50}.dollars() == 42);
+    CHECK(Money{42, 50}.cents() == 50);
+    CHECK(Money{90'000'000'000'000'000, 1}.dollars() == 90'000'000'000'000'000);
+
+    CHECK_THROWS_AS((Money{100'000'000'000'000'000, 0}), std::overflow_error);
+    CHECK_THROWS_AS((Money{-100'000'000'000'000'000, 0}), std::overflow_error);
+    CHECK_THROWS_AS((Money{1, 100}), std::invalid_argument);
+    CHECK_THROWS_AS(Money::from_cents(std::numeric_limits<int64_t>::max()) + 0.01_USD, std::overflow_error);
+
+    CHECK(Money(-1.5).in_cents() == -150);
+
+    SECTION("negative amounts")
+    {
+        constexpr Money m{-1, 50};
+        static_assert(m.in_cents() == -50);
+        static_assert(m.dollars() == -1);
+        static_assert(m.cents() == 50);
+
+        for (const Money amount : {m, Money(-1.5), Money::from_cents(-1), Money::from_cents(-100), -42.99_USD})
+        {
+            CHECK(amount.cents() >= 0);
+            CHECK(amount.cents() <= 99);
+            CHECK(Money(amount.dollars(), amount.cents()) == amount);
+        }
+    }
+
+    CHECK(0.29_USD == Money(0, 28)); // truncation like in Money(double)
+}
+
+TEST_CASE("Money - bulk operations")
+{
+    using Comparisons::Money;
+    using namespace Comparisons::Literals;
+    namespace Ledger = Comparisons::Ledger;
+
+    std::vector<Money> amounts;
+    for (int i = 0; i < 1000; ++i)
+        amounts.push_back(Money::from_cents((i * 7919) % 20'011 - 10'000));
+
+    SECTION("sum")
+    {
+        CHECK(Ledger::sum(amounts) == std::accumulate(amounts.begin(), amounts.end(), Money{0, 0}));
+        CHECK(Ledger::sum(std::span<const Money>{}) == Money{0, 0});
+    }
+
+    SECTION("sum - overflow")
+    {
+        std::vector<Money> huge(16, Money::from_cents(std::numeric_limits<int64_t>::max() / 4));
+        CHECK_THROWS_AS(Ledger::sum(huge), std::overflow_error);
+
+        // lane 0 overflows, running sum does not
+        constexpr int64_t half = std::numeric_limits<int64_t>::max() / 2 + 1;
+        std::vector<Money> alternating(16, Money{0, 0});
+        alternating[0] = alternating[8] = Money::from_cents(half);
+        alternating[1] = alternating[9] = Money::from_cents(-half);
+        CHECK(Ledger::sum(alternating) == Money{0, 0});
+    }
+
+    SECTION("minmax")
+    {
+        auto [min, max] = Ledger::minmax(amounts);
+        CHECK(min == std::ranges::min(amounts));
+        CHECK(max == std::ranges::max(amounts));
+
+        CHECK_THROWS_AS(Ledger::minmax(std::span<const Money>{}), std::invalid_argument);
+    }
+
+    SECTION("sort")
+    {
+        auto expected = amounts;
+        std::ranges::sort(expected);
+
+        Ledger::sort(amounts);
+        CHECK(amounts == expected);
+    }
+
+    SECTION("bucket counts")
+    {
+        const std::array<Money, 3> bounds{-50.00_USD, 0.00_USD, 50.00_USD};
+
+        auto counts = Ledger::bucket_counts(amounts, bounds);
+
+        REQUIRE(counts.size() == 4);
+        CHECK(counts[0] == static_cast<size_t>(std::ranges::count_if(amounts, [](Money m) { return m < -50.00_USD; })));
+        CHECK(counts[1] == static_cast<size_t>(std::ranges::count_if(amounts, [](Money m) { return m >= -50.00_USD && m < 0.00_USD; })));
+        CHECK(counts[3] == static_cast<size_t>(std::ranges::count_if(amounts, [](Money m) { return m >= 50.00_USD; })));
+        CHECK(std::accumulate(counts.begin(), counts.end(), size_t{0}) == amounts.size());
+    }
+}
+
+// Point and Point3D are not aggregates - members compared by the defaulted operator<=> are listed explicitly
+auto radix_members(const Point& pt) noexcept
+{
+    return std::tie(pt.x, pt.y);
+}
+
+auto radix_members(const Point3D& pt) noexcept
+{
+    return std::tie(pt.x, pt.y, pt.z);
+}
+
+namespace
+{
+    struct Measurement
+    {
+        int8_t sensor;
+        float value;
+        uint16_t sequence;
+
+        auto operator<=>(const Measurement&) const = default;
+
+        friend auto radix_members(const Measurement& m) noexcept
+        {
+            return std::tie(m.sensor, m.value, m.sequence);
+        }
+    };
+}
+
+TEST_CASE("radix sort")
+{
+    std::mt19937 rnd{665};
+
+    SECTION("keys are encoded with the same order")
+    {
+        CHECK(helpers::radix_encode(-1) < helpers::radix_encode(0));
+        CHECK(helpers::radix_encode(std::numeric_limits<int64_t>::min()) < helpers::radix_encode(std::numeric_limits<int64_t>::max()));
+        CHECK(helpers::radix_encode(-2.5) < helpers::radix_encode(-1.0));
+        CHECK(helpers::radix_encode(-1.0f) < helpers::radix_encode(0.5f));
+        CHECK(helpers::radix_encode(-std::numeric_limits<double>::infinity()) < helpers::radix_encode(-1e300));
+    }
+
+    SECTION("Money - single member")
+    {
+        using Comparisons::Money;
+
+        std::vector<Money> amounts;
+        for (int i = 0; i < 10'000; ++i)
+            amounts.push_back(Money::from_cents(static_cast<int64_t>(rnd()) - (1LL << 31)));
+
+        auto expected = amounts;
+        std::ranges::sort(expected);
+
+        helpers::radix_sort(amounts);
+        CHECK(amounts == expected);
+    }
+
+    SECTION("types without an order are rejected")
+    {
+        struct Unordered
+        {
+            int x;
+            int y;
+        };
+
+        struct Descending
+        {
+            int x;
+
+            auto operator<=>(const Descending& other) const { return other.x <=> x; }
+            bool operator==(const Descending&) const = default;
+        };
+
+        static_assert(helpers::RadixSortable<Point3D>);
+        static_assert(!helpers::RadixSortable<Unordered>); // members alone do not define an order
+        struct Wide
+        {
+            int a, b, c, d, e, f, g, h, i;
+
+            auto operator<=>(const Wide&) const = default;
+        };
+
+        static_assert(!helpers::RadixSortable<Descending>); // a custom order must be described with radix_members
+        static_assert(!helpers::RadixSortable<Wide>);
+    }
+
+    SECTION("Point3D - members listed with radix_members")
+    {
+        std::vector<Point3D> points;
+        for (int i = 0; i < 10'000; ++i)
+            points.emplace_back(static_cast<int>(rnd() % 5) - 2, static_cast<int>(rnd() % 3), static_cast<int>(rnd()));
+
+        auto expected = points;
+        std::ranges::sort(expected);
+
+        helpers::radix_sort(points);
+        CHECK(points == expected);
+    }
+
+    SECTION("aggregate - mixed member types")
+    {
+        static_assert(helpers::RadixSortable<Measurement>);
+
+        std::uniform_real_distribution<float> value{-100.0f, 100.0f};
+        std::vector<Measurement> measurements;
+        for (int i = 0; i < 10'000; ++i)
+            measurements.push_back(Measurement{static_cast<int8_t>(rnd() % 7 - 3), value(rnd), static_cast<uint16_t>(rnd())});
+
+        auto expected = measurements;
+        std::ranges::sort(expected);
+
+        helpers::radix_sort(measurements);
+        CHECK(measurements == expected);
+    }
+
+    SECTION("scalars")
+    {
+        std::vector<double> values{3.5, -0.25, 1e10, -1e-10, 0.0, -7.0};
+        helpers::radix_sort(values);
+        CHECK(std::ranges::is_sorted(values));
+    }
+}
+
+TEST_CASE("Money - benchmark", "[.benchmark]")
+{
+    using Comparisons::Money;
+    namespace Ledger = Comparisons::Ledger;
+
+    constexpr size_t size = 100'000'000;
+
+    std::mt19937_64 rnd{665};
+    std::uniform_int_distribution<int64_t> cents{-1'000'000'00, 1'000'000'00};
+
+    std::vector<Money> amounts;
+    amounts.reserve(size);
+    for (size_t i = 0; i < size; ++i)
+        amounts.push_back(Money::from_cents(cents(rnd)));
+
+    BENCHMARK("std::accumulate") { return std::accumulate(amounts.begin(), amounts.end(), Money{0, 0}); };
+    BENCHMARK("Ledger::sum") { return Ledger::sum(amounts); };
+
+    BENCHMARK("std::sort")
+    {
+        auto data = amounts;
+        std::sort(data.begin(), data.end());
+        return data.front();
+    };
+
+    BENCHMARK("Ledger::sort")
+    {
+        auto data = amounts;
+        Ledger::sort(data);
+        return data.front();
+    };
+}
+
 struct Human
 {
     std::string name; // std::strong_ordering
@@ -257,6 +692,281 @@ TEST_CASE("operator <=>")
     }
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// cached prefix keys
+
+namespace CachedKeys
+{
+    // 8 bytes of text starting at offset in big-endian order (padded with zeros) - keys are ordered
+    // like std::string::compare (unsigned bytes) unless they are equal
+    inline uint64_t prefix_key(std::string_view text, size_t offset = 0) noexcept
+    {
+        text.remove_prefix(std::min(offset, text.size()));
+
+        std::array<unsigned char, sizeof(uint64_t)> bytes{};
+        std::memcpy(bytes.data(), text.data(), std::min(text.size(), bytes.size()));
+
+        uint64_t key = 0;
+        for (unsigned char b : bytes)
+            key = (key << 8) | b;
+        return key;
+    }
+
+    template <typename T>
+    concept PrefixKeyed = std::three_way_comparable<T> && requires(const T& obj, size_t offset) {
+        { prefix_key(obj, offset) } noexcept -> std::same_as<uint64_t>;
+    };
+
+    template <typename T>
+    struct Entry
+    {
+        uint64_t prefix;
+        const T* item;
+
+        friend auto radix_members(const Entry& entry) noexcept
+        {
+            return std::tie(entry.prefix);
+        }
+
+        // entries with equal prefixes are equivalent - ties are resolved by PrefixLess
+        friend bool operator==(const Entry& a, const Entry& b) noexcept { return a.prefix == b.prefix; }
+        friend std::weak_ordering operator<=>(const Entry& a, const Entry& b) noexcept { return a.prefix <=> b.prefix; }
+    };
+
+    // prefixes are compared first - operator<=> of items is called only for equal prefixes
+    struct PrefixLess
+    {
+        template <typename T>
+        bool operator()(const Entry<T>& a, const Entry<T>& b) const
+        {
+            if (a.prefix != b.prefix)
+                return a.prefix < b.prefix;
+            return std::is_lt(*a.item <=> *b.item);
+        }
+    };
+
+    namespace Details
+    {
+        constexpr size_t radix_sort_threshold = 4096;
+
+        // entries are sorted by prefixes at offset; runs of equal prefixes are refined with the next 8 bytes
+        // until prefixes are zero (keys are exhausted) - then items are compared with operator<=>
+        template <typename T>
+        void refine(std::span<Entry<T>> entries, size_t offset)
+        {
+            if (entries.size() >= radix_sort_threshold)
+                helpers::radix_sort(entries);
+            else
+                std::ranges::sort(entries, {}, &Entry<T>::prefix);
+
+            for (auto first = entries.begin(); first != entries.end();)
+            {
+                const auto last = std::ranges::find_if(first + 1, entries.end(), [&](const Entry<T>& e) { return e.prefix != first->prefix; });
+                const std::span<Entry<T>> run{first, last};
+
+                if (run.size() > 1)
+                {
+                    if (first->prefix == 0)
+                        std::ranges::sort(run, PrefixLess{});
+                    else
+                    {
+                        for (Entry<T>& entry : run)
+                            entry.prefix = prefix_key(*entry.item, offset + sizeof(uint64_t));
+                        refine(run, offset + sizeof(uint64_t));
+                    }
+                }
+
+                first = last;
+            }
+        }
+
+        template <typename T>
+        std::vector<Entry<T>> make_entries(std::span<const T> items)
+        {
+            std::vector<Entry<T>> entries;
+            entries.reserve(items.size());
+            for (const T& item : items)
+                entries.push_back(Entry<T>{prefix_key(item, 0), &item});
+            return entries;
+        }
+
+        template <typename T>
+        std::vector<Entry<T>> sorted_entries(std::span<const T> items)
+        {
+            auto entries = make_entries(items);
+            refine(std::span{entries}, 0);
+
+            for (Entry<T>& entry : entries) // refined prefixes are replaced with the leading ones used for searching
+                entry.prefix = prefix_key(*entry.item, 0);
+
+            return entries;
+        }
+    } // namespace Details
+
+    // same order as std::ranges::sort(items) - items are moved once to their final position
+    template <PrefixKeyed T>
+    void sort(std::span<T> items)
+    {
+        auto entries = Details::sorted_entries(std::span<const T>{items});
+
+        std::vector<T> sorted;
+        sorted.reserve(items.size());
+        for (const Entry<T>& entry : entries)
+            sorted.push_back(std::move(const_cast<T&>(*entry.item)));
+
+        std::ranges::move(sorted, items.begin());
+    }
+
+    /*********************
+    SortedIndex
+    - sorted view of items (items are not copied and must outlive the index)
+    - prefix of each item is computed once and stored inline with the pointer to the item
+    **********************/
+    template <PrefixKeyed T>
+    class SortedIndex
+    {
+        std::vector<Entry<T>> entries_;
+
+    public:
+        explicit SortedIndex(std::span<const T> items)
+            : entries_{Details::sorted_entries(items)}
+        {
+        }
+
+        size_t size() const noexcept { return entries_.size(); }
+
+        const T& operator[](size_t index) const { return *entries_[index].item; }
+
+        auto items() const
+        {
+            return entries_ | std::views::transform([](const Entry<T>& entry) -> const T& { return *entry.item; });
+        }
+
+        // position of the first item not less than value
+        size_t lower_bound(const T& value) const
+        {
+            const Entry<T> key{prefix_key(value, 0), &value};
+            return std::ranges::lower_bound(entries_, key, PrefixLess{}) - entries_.begin();
+        }
+
+        const T* find(const T& value) const
+        {
+            const size_t pos = lower_bound(value);
+            return pos < entries_.size() && *entries_[pos].item == value ? entries_[pos].item : nullptr;
+        }
+    };
+} // namespace CachedKeys
+
+inline uint64_t prefix_key(const Human& human, size_t offset) noexcept
+{
+    return CachedKeys::prefix_key(human.name, offset);
+}
+
+namespace
+{
+    std::vector<Human> random_humans(size_t count, uint32_t seed = 665)
+    {
+        // surnames are built from common roots and suffixes - names share long prefixes and a few roots are very common
+        const std::array roots{"Nowa", "Kowal", "Wisniew", "Wojci", "Kamin", "Lewandow", "Zielin", "Szyman", "Wozni", "Dabrow", "Kozlow", "Mazur",
+            "Jankow", "Kwiatkow", "Krawcz", "Piotrow", "Grabow", "Nowakow", "Pawlow", "Michal", "Adamczy", "Dudek", "Zajac", "Wieczor", "Jablon",
+            "Krol", "Majew", "Olszew", "Jawor", "Wrobel", "Malinow", "Pawlak", "Witkow", "Walczak", "Stepien", "Gorski", "Rutkow", "Michalak",
+            "Sikor", "Ostrow"};
+        const std::array suffixes{"ski", "czyk", "ak", "ewicz", "owski", "iak", "ek", ""};
+        const std::array first_names{"Anna", "Piotr", "Maria", "Krzysztof", "Katarzyna", "Andrzej", "Malgorzata", "Tomasz", "Agnieszka", "Jan",
+            "Barbara", "Pawel", "Ewa", "Michal", "Krystyna", "Marcin", "Elzbieta", "Grzegorz", "Zofia", "Jozef", "Teresa", "Marek", "Joanna", "Adam"};
+
+        std::mt19937 rnd{seed};
+        std::geometric_distribution<size_t> root{0.05};
+        std::uniform_int_distribution<size_t> suffix{0, suffixes.size() - 1};
+        std::uniform_int_distribution<size_t> first_name{0, first_names.size() - 1};
+        std::uniform_int_distribution<int> age{18, 90};
+        std::uniform_real_distribution<double> height{1.5, 2.0};
+
+        std::vector<Human> humans;
+        humans.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string name = roots[std::min(root(rnd), roots.size() - 1)];
+            name += suffixes[suffix(rnd)];
+            name += ' ';
+            name += first_names[first_name(rnd)];
+            humans.push_back(Human{std::move(name), static_cast<uint8_t>(age(rnd)), height(rnd)});
+        }
+
+        return humans;
+    }
+} // namespace
+
+TEST_CASE("cached prefix keys")
+{
+    using CachedKeys::prefix_key;
+
+    SECTION("prefix keys are ordered like strings")
+    {
+        CHECK(prefix_key("Adam") < prefix_key("Anna"));
+        CHECK(prefix_key("Ann") < prefix_key("Anna"));
+        CHECK(prefix_key("") < prefix_key("A"));
+        CHECK(prefix_key("Kowalski Jan") == prefix_key("Kowalski Anna")); // tie - full comparison is needed
+        CHECK(prefix_key("\xC5\x81ukasz") > prefix_key("Zenon"));          // bytes are compared as unsigned
+        CHECK("\xC5\x81ukasz"s > "Zenon"s);
+    }
+
+    auto humans = random_humans(10'000);
+    humans.push_back(Human{"Kowalski Jan", 42, 1.80});
+    humans.push_back(Human{"Kowalski Jan", 42, 1.75});
+    humans.push_back(Human{"Kowal", 30, 1.70});
+
+    auto expected = humans;
+    std::ranges::sort(expected);
+
+    SECTION("sort gives the same order as operator <=>")
+    {
+        CachedKeys::sort(std::span{humans});
+
+        CHECK(humans == expected);
+    }
+
+    SECTION("sorted index")
+    {
+        CachedKeys::SortedIndex<Human> index{humans};
+
+        REQUIRE(index.size() == humans.size());
+        CHECK(std::ranges::equal(index.items(), expected));
+
+        const Human jan{"Kowalski Jan", 42, 1.75};
+        REQUIRE(index.find(jan) != nullptr);
+        CHECK(*index.find(jan) == jan);
+        CHECK(index.find(Human{"Kowalski Jan", 42, 1.77}) == nullptr);
+
+        CHECK(index[index.lower_bound(Human{"Kowal", 0, 0.0})] == Human{"Kowal", 30, 1.70});
+    }
+}
+
+TEST_CASE("cached prefix keys - benchmark", "[.benchmark]")
+{
+    const auto humans = random_humans(10'000'000);
+
+    BENCHMARK("std::ranges::sort - 10M humans")
+    {
+        auto data = humans;
+        std::ranges::sort(data);
+        return data.front().age;
+    };
+
+    BENCHMARK("CachedKeys::sort - 10M humans")
+    {
+        auto data = humans;
+        CachedKeys::sort(std::span{data});
+        return data.front().age;
+    };
+
+    BENCHMARK("CachedKeys::SortedIndex - 10M humans")
+    {
+        CachedKeys::SortedIndex<Human> index{humans};
+        return index[0].age;
+    };
+}
+
 struct Base
 {
     std::string value;
@@ -277,32 +987,158 @@ struct Derived : Base
 
 namespace Comparisons
 {
+    /*********************
+    Data - value type for buffers of ints
+    - up to inline_capacity values are stored inside of the object (no allocation)
+    - larger buffers are allocated from a pool and shared by copies (reference counted)
+    - a shared buffer is copied before modification (copy-on-write)
+    **********************/
     class Data
     {
-        int* buffer_;
+    public:
+        static constexpr size_t inline_capacity = 48 / sizeof(int);
+
+    private:
+        struct SharedBuffer
+        {
+            std::atomic<size_t> ref_count;
+            size_t size;
+
+            int* values() noexcept { return reinterpret_cast<int*>(this + 1); }
+        };
+
+        static_assert(sizeof(SharedBuffer) % alignof(int) == 0);
+
+        union Storage
+        {
+            int inline_values[inline_capacity];
+            SharedBuffer* shared;
+        };
+
+        Storage storage_{}; // trivially copyable - swapped and moved as raw bytes
         size_t size_;
 
+        static std::pmr::memory_resource& pool()
+        {
+            static std::pmr::synchronized_pool_resource pool_resource;
+            return pool_resource;
+        }
+
+        static SharedBuffer* allocate(std::span<const int> values)
+        {
+            void* memory = pool().allocate(sizeof(SharedBuffer) + values.size_bytes(), alignof(SharedBuffer));
+            auto* buffer = new (memory) SharedBuffer{1, values.size()};
+            std::ranges::copy(values, buffer->values());
+            return buffer;
+        }
+
+        void release() noexcept
+        {
+            if (!is_inline() && storage_.shared->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                const size_t bytes = sizeof(SharedBuffer) + storage_.shared->size * sizeof(int);
+                storage_.shared->~SharedBuffer();
+                pool().deallocate(storage_.shared, bytes, alignof(SharedBuffer));
+            }
+        }
+
+        // gives the buffer to this object only
+        void detach()
+        {
+            if (!is_inline() && storage_.shared->ref_count.load(std::memory_order_acquire) > 1)
+            {
+                SharedBuffer* copy = allocate(values());
+                release();
+                storage_.shared = copy;
+            }
+        }
+
     public:
         Data(std::initializer_list<int> values)
-            : buffer_(new int[values.size()])
-            , size_(values.size())
+            : Data(std::span<const int>{values.begin(), values.size()})
+        {
+        }
+
+        explicit Data(std::span<const int> values)
+            : size_{values.size()}
         {
-            std::copy(values.begin(), values.end(), buffer_);
+            if (is_inline())
+                std::ranges::copy(values, storage_.inline_values);
+            else
+                storage_.shared = allocate(values);
+        }
+
+        Data(const Data& other) noexcept
+            : size_{other.size_}
+        {
+            if (is_inline())
+                std::ranges::copy(other.values(), storage_.inline_values);
+            else
+            {
+                storage_.shared = other.storage_.shared;
+                storage_.shared->ref_count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        Data(Data&& other) noexcept
+            : storage_{other.storage_}
+            , size_{std::exchange(other.size_, 0)}
+        {
+        }
+
+        Data& operator=(Data other) noexcept
+        {
+            swap(other);
+            return *this;
         }
 
         ~Data()
         {
-            delete[] buffer_;
+            release();
+        }
+
+        void swap(Data& other) noexcept
+        {
+            std::swap(storage_, other.storage_);
+            std::swap(size_, other.size_);
+        }
+
+        size_t size() const noexcept { return size_; }
+        bool is_inline() const noexcept { return size_ <= inline_capacity; }
+        bool is_shared() const noexcept { return !is_inline() && storage_.shared->ref_count.load(std::memory_order_relaxed) > 1; }
+
+        std::span<const int> values() const noexcept
+        {
+            return {is_inline() ? storage_.inline_values : storage_.shared->values(), size_};
+        }
+
+        int operator[](size_t index) const noexcept
+        {
+            return values()[index];
+        }
+
+        void set(size_t index, int value)
+        {
+            assert(index < size_);
+
+            detach();
+            (is_inline() ? storage_.inline_values : storage_.shared->values())[index] = value;
         }
 
         bool operator==(const Data& other) const 
         {
-            return size_ == other.size_ && std::equal(buffer_, buffer_ + size_, other.buffer_);
+            if (!is_inline() && size_ == other.size_ && storage_.shared == other.storage_.shared)
+                return true;
+
+            return helpers::equal(values(), other.values());
         }
 
         auto operator<=>(const Data& other) const
         {
-            return std::lexicographical_compare_three_way(buffer_, buffer_ + size_, other.buffer_, other.buffer_ + other.size_);
+            if (!is_inline() && size_ == other.size_ && storage_.shared == other.storage_.shared)
+                return std::strong_ordering::equal;
+
+            return helpers::compare_three_way(values(), other.values());
         }
     };
 } //namespace Comparisons
@@ -317,4 +1153,262 @@ TEST_CASE("lexicographical_compare_three_way")
 
     CHECK(data1 == data2);
     CHECK(data1 < data3);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Data - small buffer & copy-on-write")
+{
+    using Comparisons::Data;
+
+    std::vector<int> values(100);
+    std::iota(values.begin(), values.end(), 0);
+
+    SECTION("small buffers are stored inline")
+    {
+        Data small{1, 2, 3};
+        CHECK(small.is_inline());
+
+        Data large{values};
+        CHECK_FALSE(large.is_inline());
+        CHECK(std::ranges::equal(large.values(), values));
+    }
+
+    SECTION("copies share large buffer until modification")
+    {
+        Data original{values};
+        Data copy = original;
+
+        CHECK(original.is_shared());
+        CHECK(copy.values().data() == original.values().data());
+
+        copy.set(10, -1);
+
+        CHECK_FALSE(original.is_shared());
+        CHECK(original[10] == 10);
+        CHECK(copy[10] == -1);
+        CHECK(copy < original);
+    }
+
+    SECTION("move steals buffer")
+    {
+        Data original{values};
+        const int* buffer = original.values().data();
+
+        Data moved = std::move(original);
+
+        CHECK(moved.values().data() == buffer);
+        CHECK(original.size() == 0);
+    }
+
+    SECTION("assignment")
+    {
+        Data a{1, 2, 3};
+        Data b{values};
+
+        a = b;
+        CHECK(a == b);
+        CHECK(a.is_shared());
+
+        b = Data{4, 5};
+        CHECK(b == Data{4, 5});
+        CHECK_FALSE(a.is_shared());
+        CHECK(a.size() == values.size());
+    }
+}
+
+TEST_CASE("SIMD lexicographical_compare_three_way")
+{
+    std::vector<int> data(1000);
+    std::iota(data.begin(), data.end(), -500);
+
+    SECTION("mismatch at every position gives the same result as std algorithms")
+    {
+        for (size_t pos = 0; pos < data.size(); pos += 37)
+        {
+            auto other = data;
+            other[pos] += (pos % 2 == 0) ? 1 : -1;
+
+            CHECK(helpers::lexicographical_compare_three_way(data, other) == std::lexicographical_compare_three_way(data.begin(), data.end(), other.begin(), other.end()));
+            CHECK_FALSE(helpers::equal(data, other));
+        }
+
+        CHECK(helpers::equal(data, std::vector(data)));
+    }
+
+    SECTION("prefix is less")
+    {
+        const std::span<const int> prefix{data.data(), 999};
+
+        CHECK(helpers::compare_three_way(prefix, std::span<const int>{data}) == std::strong_ordering::less);
+        CHECK(helpers::compare_three_way(std::span<const int>{}, std::span<const int>{}) == std::strong_ordering::equal);
+    }
+
+    SECTION("bytes are compared as unsigned char")
+    {
+        const std::vector<unsigned char> a(100, 0x7F);
+        auto b = a;
+        b[70] = 0x80;
+
+        CHECK(helpers::lexicographical_compare_three_way(a, b) == std::strong_ordering::less);
+    }
+
+    SECTION("floats - signed zeros are equal, NaN is unordered")
+    {
+        std::vector<float> a(100, 1.0f);
+        auto b = a;
+        a[50] = 0.0f;
+        b[50] = -0.0f;
+
+        CHECK(helpers::lexicographical_compare_three_way(a, b) == std::partial_ordering::equivalent);
+        CHECK(helpers::equal(a, b));
+
+        b[80] = std::numeric_limits<float>::quiet_NaN();
+        CHECK(helpers::lexicographical_compare_three_way(a, b) == std::partial_ordering::unordered);
+    }
+
+    SECTION("non contiguous ranges use std algorithms")
+    {
+        std::list<int> lst(data.begin(), data.end());
+
+        CHECK(helpers::equal(lst, data));
+        CHECK(helpers::lexicographical_compare_three_way(lst, data) == std::strong_ordering::equal);
+    }
+
+    SECTION("lexicographic adaptor")
+    {
+        const std::vector<int> copy = data;
+        std::vector<int> smaller = data;
+        smaller.back() = -1000;
+
+        CHECK((data | helpers::lexicographic) == (copy | helpers::lexicographic));
+        CHECK((smaller | helpers::lexicographic) < (data | helpers::lexicographic));
+        CHECK(helpers::lexicographic(data) > helpers::lexicographic(smaller));
+    }
+}
+
+TEST_CASE("SIMD lexicographical_compare_three_way - benchmark", "[.benchmark]")
+{
+    for (size_t bytes : {1024, 64 * 1024, 16 * 1024 * 1024})
+    {
+        const auto suffix = " - "s + (bytes < 1024 * 1024 ? std::to_string(bytes / 1024) + " KB" : std::to_string(bytes / (1024 * 1024)) + " MB");
+
+        std::vector<int> a(bytes / sizeof(int));
+        std::iota(a.begin(), a.end(), 0);
+        auto b = a;
+        b.back() += 1; // mismatch at the end - whole buffers are scanned
+
+        std::vector<float> fa(a.begin(), a.end());
+        std::vector<float> fb(b.begin(), b.end());
+
+        BENCHMARK("std::lexicographical_compare_three_way - int" + suffix) { return std::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end()); };
+        BENCHMARK("helpers::lexicographical_compare_three_way - int" + suffix) { return helpers::lexicographical_compare_three_way(a, b); };
+        BENCHMARK("std::equal - int" + suffix) { return std::equal(a.begin(), a.end(), b.begin(), b.end()); };
+        BENCHMARK("helpers::equal - int" + suffix) { return helpers::equal(a, b); };
+        BENCHMARK("std::lexicographical_compare_three_way - float" + suffix) { return std::lexicographical_compare_three_way(fa.begin(), fa.end(), fb.begin(), fb.end()); };
+        BENCHMARK("helpers::lexicographical_compare_three_way - float" + suffix) { return helpers::lexicographical_compare_three_way(fa, fb); };
+    }
+}
+
+TEST_CASE("radix sort - benchmark", "[.benchmark]")
+{
+    std::mt19937 rnd{665};
+
+    for (size_t size : {10'000'000, 100'000'000})
+    {
+        const auto suffix = " - "s + std::to_string(size / 1'000'000) + "M Points";
+
+        std::vector<Point> points;
+        points.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            points.emplace_back(static_cast<int>(rnd()), static_cast<int>(rnd()));
+
+        BENCHMARK("std::sort" + suffix)
+        {
+            auto data = points;
+            std::sort(data.begin(), data.end());
+            return data.front().x;
+        };
+
+        BENCHMARK("std::ranges::sort" + suffix)
+        {
+            auto data = points;
+            std::ranges::sort(data);
+            return data.front().x;
+        };
+
+        BENCHMARK("helpers::radix_sort" + suffix)
+        {
+            auto data = points;
+            helpers::radix_sort(data);
+            return data.front().x;
+        };
+    }
+}
+
+namespace
+{
+    // Data before small buffer optimization & copy-on-write
+    class HeapData
+    {
+        int* buffer_;
+        size_t size_;
+
+    public:
+        explicit HeapData(std::span<const int> values)
+            : buffer_(new int[values.size()])
+            , size_(values.size())
+        {
+            std::ranges::copy(values, buffer_);
+        }
+
+        HeapData(const HeapData& other)
+            : HeapData(std::span<const int>{other.buffer_, other.size_})
+        {
+        }
+
+        HeapData& operator=(const HeapData&) = delete;
+
+        ~HeapData()
+        {
+            delete[] buffer_;
+        }
+
+        bool operator==(const HeapData& other) const
+        {
+            return size_ == other.size_ && std::equal(buffer_, buffer_ + size_, other.buffer_);
+        }
+    };
+} // namespace
+
+TEST_CASE("Data - benchmark", "[.benchmark]")
+{
+    using Comparisons::Data;
+
+    for (size_t size : {1, 10, 100, 10'000, 1'000'000})
+    {
+        const auto suffix = " - "s + std::to_string(size) + " items";
+
+        std::vector<int> values(size);
+        std::iota(values.begin(), values.end(), 0);
+
+        const HeapData heap_data{values};
+        const Data data{values};
+
+        BENCHMARK("HeapData - construct" + suffix) { return HeapData{values}; };
+        BENCHMARK("std::vector<int> - construct" + suffix) { return std::vector<int>(values.begin(), values.end()); };
+        BENCHMARK("Data - construct" + suffix) { return Data{values}; };
+
+        BENCHMARK("HeapData - copy" + suffix) { return HeapData{heap_data}; };
+        BENCHMARK("std::vector<int> - copy" + suffix) { return std::vector<int>{values}; };
+        BENCHMARK("Data - copy" + suffix) { return Data{data}; };
+
+        const HeapData heap_data_copy{heap_data};
+        const std::vector<int> values_copy{values};
+        const Data data_copy{data};           // shared buffer
+        const Data data_deep_copy{values};    // separate buffer
+
+        BENCHMARK("HeapData - compare" + suffix) { return heap_data == heap_data_copy; };
+        BENCHMARK("std::vector<int> - compare" + suffix) { return values == values_copy; };
+        BENCHMARK("Data - compare copies" + suffix) { return data == data_copy; };
+        BENCHMARK("Data - compare equal values" + suffix) { return data == data_deep_copy; };
+    }
+}
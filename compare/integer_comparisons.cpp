@@ -1,6 +1,14 @@
+#include <integer_compare.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -34,4 +42,245 @@ TEST_CASE("safe comparing integral numbers")
         CHECK(std::in_range<size_t>(-1) == false);
         CHECK(std::in_range<uint8_t>(257) == false);
     }
-}
\ No newline at end of file
+}
+
+namespace
+{
+    using Integers = std::tuple<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t>;
+
+    template <typename F>
+    void for_each_integer_type(F f)
+    {
+        [&]<typename... Ts>(std::tuple<Ts...>*) { (f.template operator()<Ts>(), ...); }(static_cast<Integers*>(nullptr));
+    }
+
+    // limits of all integer types & values around zero converted to T - many rows cross the boundaries of other types
+    template <typename T>
+    std::vector<T> boundary_values(size_t size, size_t shift = 0)
+    {
+        std::vector<T> edges;
+        for_each_integer_type([&]<typename U>() {
+            edges.push_back(static_cast<T>(std::numeric_limits<U>::min()));
+            edges.push_back(static_cast<T>(std::numeric_limits<U>::max()));
+            edges.push_back(static_cast<T>(std::numeric_limits<U>::max() - 1));
+        });
+        for (int value : {-2, -1, 0, 1, 2})
+            edges.push_back(static_cast<T>(value));
+
+        std::vector<T> values(size);
+        for (size_t i = 0; i < size; ++i)
+            values[i] = edges[((i + shift) * 7 + (i + shift) / edges.size()) % edges.size()];
+        return values;
+    }
+} // namespace
+
+TEST_CASE("cmp_* & in_range for columns")
+{
+    constexpr size_t rows = 150; // two full blocks of 64 rows & a tail
+
+    SECTION("column <=> column - all signed/unsigned width pairs")
+    {
+        for_each_integer_type([&]<typename T>() {
+            for_each_integer_type([&]<typename U>() {
+                const std::vector<T> a = boundary_values<T>(rows);
+                const std::vector<U> b = boundary_values<U>(rows, 3);
+
+                const auto less = helpers::cmp_less(a, b);
+                const auto equal = helpers::cmp_equal(a, b);
+
+                for (size_t i = 0; i < rows; ++i)
+                {
+                    CHECK(less[i] == std::cmp_less(a[i], b[i]));
+                    CHECK(equal[i] == std::cmp_equal(a[i], b[i]));
+                }
+            });
+        });
+    }
+
+    SECTION("column <=> value")
+    {
+        const std::vector<int64_t> column = boundary_values<int64_t>(rows);
+
+        for (uint32_t value : {0u, 1u, 255u, std::numeric_limits<uint32_t>::max()})
+        {
+            const auto less = helpers::cmp_less(column, value);
+            const auto greater = helpers::cmp_less(value, column);
+            const auto equal = helpers::cmp_equal(column, value);
+
+            for (size_t i = 0; i < rows; ++i)
+            {
+                CHECK(less[i] == std::cmp_less(column[i], value));
+                CHECK(greater[i] == std::cmp_greater(column[i], value));
+                CHECK(equal[i] == std::cmp_equal(column[i], value));
+            }
+        }
+    }
+
+    SECTION("in_range")
+    {
+        for_each_integer_type([&]<typename T>() {
+            const std::vector<T> column = boundary_values<T>(rows);
+
+            for_each_integer_type([&]<typename R>() {
+                const auto in_range = helpers::in_range<R>(column);
+
+                for (size_t i = 0; i < rows; ++i)
+                    CHECK(in_range[i] == std::in_range<R>(column[i]));
+            });
+        });
+    }
+
+    SECTION("selection vector")
+    {
+        const std::vector<int> column = {-1, 5, -7, 0, 3, -2};
+
+        CHECK(helpers::select(helpers::cmp_less(column, 0u)) == std::vector<uint32_t>{0, 2, 5});
+        CHECK(helpers::select(helpers::in_range<unsigned>(column)) == std::vector<uint32_t>{1, 3, 4});
+    }
+}
+
+TEST_CASE("cmp_* for columns - benchmark", "[.benchmark]")
+{
+    constexpr size_t rows = 100'000'000;
+
+    std::mt19937_64 rnd_gen{42};
+    std::vector<int32_t> prices(rows);
+    std::vector<uint32_t> limits(rows);
+    for (size_t i = 0; i < rows; ++i)
+    {
+        prices[i] = static_cast<int32_t>(rnd_gen());
+        limits[i] = static_cast<uint32_t>(rnd_gen());
+    }
+
+    std::vector<uint32_t> selection(rows);
+    helpers::bits::DynamicBitset mask(rows);
+
+    BENCHMARK("scalar std::cmp_less - selection vector")
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < rows; ++i)
+            if (std::cmp_less(prices[i], limits[i]))
+                selection[count++] = static_cast<uint32_t>(i);
+        return count;
+    };
+
+    BENCHMARK("helpers::cmp_less - bitmask")
+    {
+        helpers::cmp_less(prices, limits, mask);
+        return mask.words()[0];
+    };
+
+    BENCHMARK("helpers::cmp_less - selection vector")
+    {
+        helpers::cmp_less(prices, limits, mask);
+        return helpers::select(mask, std::span{selection});
+    };
+
+    BENCHMARK("scalar std::in_range<int16_t> - bitmask")
+    {
+        for (size_t i = 0; i < rows; ++i)
+            mask.set(i, std::in_range<int16_t>(prices[i]));
+        return mask.words()[0];
+    };
+
+    BENCHMARK("helpers::in_range<int16_t> - bitmask")
+    {
+        helpers::in_range<int16_t>(prices, mask);
+        return mask.words()[0];
+    };
+}
+
+TEST_CASE("narrowing columns")
+{
+    SECTION("all values fit")
+    {
+        std::vector<int64_t> column(10'000);
+        for (size_t i = 0; i < column.size(); ++i)
+            column[i] = static_cast<int64_t>(i % 256);
+
+        std::vector<uint8_t> narrowed(column.size());
+
+        CHECK(helpers::narrow_into(column, narrowed) == column.size());
+        CHECK(std::ranges::equal(column, narrowed));
+    }
+
+    SECTION("first value out of range is reported & preceding values are converted")
+    {
+        std::vector<size_t> column(10'000, 42);
+        column[5'000] = 256;
+        column[7'000] = 1'000;
+
+        std::vector<uint8_t> narrowed(column.size());
+
+        CHECK(helpers::narrow_into(column, narrowed) == 5'000);
+        CHECK(std::ranges::all_of(narrowed | std::views::take(5'000), [](uint8_t value) { return value == 42; }));
+    }
+
+    SECTION("negative values do not fit in unsigned types")
+    {
+        const std::vector<int64_t> column = {0, 1, -1, 2};
+        std::vector<uint32_t> narrowed(column.size());
+
+        CHECK(helpers::narrow_into(column, narrowed) == 2);
+    }
+
+    SECTION("widening is never checked")
+    {
+        const std::vector<int16_t> column = {-32768, 0, 32767};
+        std::vector<int32_t> widened(column.size());
+
+        CHECK(helpers::narrow_into(column, widened) == column.size());
+        CHECK(widened == std::vector<int32_t>{-32768, 0, 32767});
+    }
+
+    SECTION("all signed/unsigned width pairs")
+    {
+        for_each_integer_type([&]<typename From>() {
+            const std::vector<From> column = boundary_values<From>(10'000);
+
+            for_each_integer_type([&]<typename To>() {
+                std::vector<To> narrowed(column.size());
+
+                const auto expected = std::ranges::find_if(column, [](From value) { return !std::in_range<To>(value); }) - column.begin();
+                CHECK(helpers::narrow_into(column, narrowed) == static_cast<size_t>(expected));
+            });
+        });
+    }
+
+    SECTION("narrow throws")
+    {
+        const std::vector<int64_t> column = {1, 2, std::numeric_limits<int32_t>::max() + int64_t{1}};
+
+        CHECK(helpers::narrow<int32_t>(std::span{column}.first(2)) == std::vector<int32_t>{1, 2});
+        CHECK_THROWS_AS(helpers::narrow<int32_t>(column), std::out_of_range);
+    }
+}
+
+TEST_CASE("narrowing columns - benchmark", "[.benchmark]")
+{
+    constexpr size_t rows = 100'000'000;
+
+    std::mt19937_64 rnd_gen{42};
+    std::uniform_int_distribution<int64_t> distr{0, 255};
+    std::vector<int64_t> column(rows);
+    for (auto& value : column)
+        value = distr(rnd_gen);
+
+    std::vector<uint8_t> narrowed(rows);
+
+    BENCHMARK("std::in_range + static_cast")
+    {
+        for (size_t i = 0; i < rows; ++i)
+        {
+            if (!std::in_range<uint8_t>(column[i]))
+                return i;
+            narrowed[i] = static_cast<uint8_t>(column[i]);
+        }
+        return rows;
+    };
+
+    BENCHMARK("helpers::narrow_into")
+    {
+        return helpers::narrow_into(column, narrowed);
+    };
+}
@@ -1,3 +1,8 @@
+#include <arena.hpp>
+#include <datasets.hpp>
+#include <numeric_array.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <vector>
@@ -7,6 +12,8 @@
 #include <numeric>
 #include <algorithm>
 #include <span>
+#include <memory>
+#include <memory_resource>
 
 using namespace std::literals;
 
@@ -117,12 +124,23 @@ constexpr auto create_powers()
     return powers;
 }
 
-template <std::ranges::input_range... TRng_>
-constexpr auto avg_for_unique(const TRng_&... rng)
+// expression templates - single pass without the intermediate sequence
+template <size_t N>
+constexpr auto create_powers_fused()
+{
+    constexpr auto x = helpers::arange<uint32_t, N>(1);
+
+    return helpers::NumericArray<uint32_t, N>{x * x};
+}
+
+// transient vector is allocated with alloc - e.g. helpers::ArenaAllocator to avoid heap allocations in hot calls
+template <typename TAllocator, std::ranges::input_range... TRng_>
+constexpr auto avg_for_unique(std::allocator_arg_t, const TAllocator& alloc, const TRng_&... rng)
 {
     using TElement = std::common_type_t<std::ranges::range_value_t<TRng_>...>;
+    using TElementAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<TElement>;
 
-    std::vector<TElement> vec;                            // empty vector
+    std::vector<TElement, TElementAllocator> vec(TElementAllocator{alloc}); // empty vector
     vec.reserve((rng.size() + ...));                      // reserve a buffer - fold expression C++17
     (vec.insert(vec.end(), rng.begin(), rng.end()), ...); // fold expression C++17
 
@@ -139,9 +157,17 @@ constexpr auto avg_for_unique(const TRng_&... rng)
     return sum / static_cast<double>(unique_items.size());
 }
 
+template <std::ranges::input_range... TRng_>
+constexpr auto avg_for_unique(const TRng_&... rng)
+{
+    return avg_for_unique(std::allocator_arg, std::allocator<std::byte>{}, rng...);
+}
+
 TEST_CASE("compile-time programming")
 {
     constexpr auto powers_lookup = create_powers<100>();
+
+    static_assert(std::ranges::equal(create_powers_fused<100>(), powers_lookup));
 }
 
 TEST_CASE("avg for unique")
@@ -152,4 +178,226 @@ TEST_CASE("avg for unique")
     constexpr auto avg = avg_for_unique(lst1, lst2);
 
     std::cout << "AVG: " << avg << "\n";
-}
\ No newline at end of file
+
+    SECTION("arena allocator - std::allocator during constant evaluation")
+    {
+        STATIC_CHECK(avg_for_unique(std::allocator_arg, helpers::ArenaAllocator<int>{}, lst1, lst2) == avg);
+    }
+
+    SECTION("arena allocator - no heap allocations at runtime")
+    {
+        std::byte buffer[256];
+        std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer), std::pmr::null_memory_resource()}; // throws if buffer is too small
+
+        CHECK(avg_for_unique(std::allocator_arg, helpers::ArenaAllocator<int>{&arena}, lst1, lst2) == avg);
+    }
+
+    SECTION("stack arena")
+    {
+        helpers::StackArena<256> arena;
+        std::vector<int> heap_items(1000, 1); // larger than the arena - overflows to the heap
+
+        CHECK(avg_for_unique(std::allocator_arg, helpers::ArenaAllocator<int>{arena}, lst1, lst2) == avg);
+        CHECK(avg_for_unique(std::allocator_arg, helpers::ArenaAllocator<int>{arena}, heap_items, lst1) == 3.0);
+    }
+}
+
+TEST_CASE("avg for unique - benchmark", "[.benchmark]")
+{
+    constexpr size_t calls = 1'000'000;
+
+    std::vector<int> lst1 = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<int> lst2 = {5, 6, 7, 8, 9, 10, 11, 12};
+
+    BENCHMARK("std::allocator")
+    {
+        double total = 0.0;
+        for (size_t i = 0; i < calls; ++i)
+        {
+            lst1[0] = static_cast<int>(i % 16); // input changes - calls are not hoisted out of the loop
+            total += avg_for_unique(lst1, lst2);
+        }
+        return total;
+    };
+
+    BENCHMARK("helpers::StackArena per call")
+    {
+        double total = 0.0;
+        for (size_t i = 0; i < calls; ++i)
+        {
+            lst1[0] = static_cast<int>(i % 16);
+            helpers::StackArena<256> arena;
+            total += avg_for_unique(std::allocator_arg, helpers::ArenaAllocator<int>{arena}, lst1, lst2);
+        }
+        return total;
+    };
+
+    BENCHMARK("helpers::StackArena - release after call")
+    {
+        helpers::StackArena<256> arena;
+
+        double total = 0.0;
+        for (size_t i = 0; i < calls; ++i)
+        {
+            lst1[0] = static_cast<int>(i % 16);
+            total += avg_for_unique(std::allocator_arg, helpers::ArenaAllocator<int>{arena}, lst1, lst2);
+            arena.release();
+        }
+        return total;
+    };
+}
+////////////////////////////////////////////////////////////////////////
+// datasets generated at compile time
+
+constinit std::array<int, 1000> embedded_dataset = helpers::make_numeric_dataset<1000>({.seed = 665, .low = 0, .high = 10});
+
+TEST_CASE("numeric datasets")
+{
+    static_assert(std::ranges::all_of(helpers::baked_numeric_dataset<256>, [](int x) { return -100 <= x && x < 100; }));
+
+    SECTION("compile-time & runtime generation give the same data")
+    {
+        constexpr auto compile_time_data = helpers::make_numeric_dataset<1000>({.seed = 665, .low = 0, .high = 10});
+
+        std::vector<int> runtime_data(1000);
+        helpers::fill_numeric_dataset(runtime_data, {.seed = 665, .low = 0, .high = 10});
+
+        CHECK(std::ranges::equal(compile_time_data, runtime_data));
+        CHECK(std::ranges::equal(embedded_dataset, runtime_data));
+    }
+
+    SECTION("generation from the middle of a dataset")
+    {
+        std::vector<int> data(300'000); // a few chunks
+        helpers::fill_numeric_dataset(data);
+
+        std::vector<int> tail(1000);
+        helpers::fill_numeric_dataset(tail, {}, 299'000);
+
+        CHECK(std::ranges::equal(std::span{data}.last(1000), tail));
+    }
+
+    SECTION("dataset in static storage")
+    {
+        auto data = helpers::numeric_dataset<10'000>();
+
+        CHECK(data.data() == helpers::numeric_dataset<10'000>().data());
+        CHECK(std::ranges::equal(data, helpers::make_numeric_dataset<10'000>()));
+    }
+}
+
+TEST_CASE("numeric datasets - benchmark", "[.benchmark]")
+{
+    constexpr size_t size = 1'000'000;
+
+    std::vector<int> data(size);
+    uint32_t seed = 0;
+
+    BENCHMARK("runtime generation - 1M items")
+    {
+        helpers::fill_numeric_dataset(data, {.seed = ++seed});
+        return data.back();
+    };
+
+    BENCHMARK("copy of a dataset - 1M items")
+    {
+        auto dataset = helpers::numeric_dataset<size>();
+        std::ranges::copy(dataset, data.begin());
+        return data.back();
+    };
+}
+
+////////////////////////////////////////////////////////////////////////
+// expression templates
+
+TEST_CASE("numeric array - expression templates")
+{
+    using helpers::NumericArray;
+
+    SECTION("constexpr")
+    {
+        constexpr NumericArray<int, 4> a = {1, 2, 3, 4};
+        constexpr NumericArray<int, 4> b = {10, 20, 30, 40};
+
+        constexpr NumericArray<int, 4> result = a * a + b - 1;
+        static_assert(result == NumericArray<int, 4>{10, 23, 38, 55});
+
+        static_assert([] {
+            NumericArray<double> data(3, 2.0); // std::vector storage
+            data *= data + 1.0;
+            return data[2];
+        }() == 6.0);
+    }
+
+    SECTION("expression is evaluated lazily")
+    {
+        NumericArray<float> a = {1.0f, 2.0f, 3.0f};
+        NumericArray<float> b = {0.5f, 0.5f, 0.5f};
+
+        auto expr = a * b + 2.0f * -a;
+        a[0] = 10.0f; // operands are held by reference
+
+        NumericArray<float> result = expr;
+        CHECK(result == NumericArray<float>{-15.0f, -3.0f, -4.5f});
+    }
+
+    SECTION("expression may refer to the assigned array")
+    {
+        NumericArray<int> a(1000, 3);
+        NumericArray<int> b(1000, 1);
+
+        a = a * a + b;
+        CHECK(std::ranges::all_of(a, [](int x) { return x == 10; }));
+
+        a -= b / 1;
+        CHECK(std::ranges::all_of(a, [](int x) { return x == 9; }));
+    }
+
+    SECTION("sizes of operands must match")
+    {
+        NumericArray<int> a(10);
+        NumericArray<int> b(11);
+
+        CHECK_THROWS_AS(a + b, std::invalid_argument);
+    }
+
+    SECTION("arange")
+    {
+        NumericArray<double> halves = helpers::arange<double>(5, 1.0) / 2.0;
+        CHECK(halves == NumericArray<double>{0.5, 1.0, 1.5, 2.0, 2.5});
+    }
+}
+
+TEST_CASE("numeric array - benchmark", "[.benchmark]")
+{
+    constexpr size_t size = 100'000'000;
+
+    helpers::NumericArray<float> a(size, 1.5f);
+    helpers::NumericArray<float> b(size, 2.0f);
+    helpers::NumericArray<float> c(size, 0.5f);
+    helpers::NumericArray<float> result(size);
+
+    BENCHMARK("chained std::transform - a * b + c * 2 - a")
+    {
+        std::vector<float> ab(size);
+        std::vector<float> c2(size);
+        std::ranges::transform(a, b, ab.begin(), std::multiplies{});
+        std::ranges::transform(c, c2.begin(), [](float x) { return x * 2.0f; });
+        std::ranges::transform(ab, c2, ab.begin(), std::plus{});
+        std::ranges::transform(ab, a, result.begin(), std::minus{});
+        return result[size - 1];
+    };
+
+    BENCHMARK("expression template - a * b + c * 2 - a")
+    {
+        result = a * b + c * 2.0f - a;
+        return result[size - 1];
+    };
+
+    BENCHMARK("hand written loop - a * b + c * 2 - a")
+    {
+        for (size_t i = 0; i < size; ++i)
+            result[i] = a[i] * b[i] + c[i] * 2.0f - a[i];
+        return result[size - 1];
+    };
+}
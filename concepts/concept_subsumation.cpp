@@ -1,8 +1,21 @@
+#include <algorithm>
+#include <bit>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <concepts>
+#include <cassert>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <random>
+#include <ranges>
+#include <span>
 #include <string>
+#include <tuple>
 #include <vector>
 
 using namespace std::literals;
@@ -91,4 +104,1095 @@ TEST_CASE("concept subsumation")
 
     render(r);
     render(cr);
-}
\ No newline at end of file
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// batched rendering
+
+/*********************
+Framebuffer
+- pixels are stored row by row
+- boxes are drawn from the origin (0, 0) and clipped to the size of the framebuffer
+**********************/
+class Framebuffer
+{
+    int width_, height_;
+    std::vector<Color> pixels_;
+
+public:
+    Framebuffer(int width, int height, Color background = Color{0, 0, 0})
+        : width_{width}
+        , height_{height}
+        , pixels_(static_cast<size_t>(width) * height, background)
+    {
+    }
+
+    int width() const noexcept { return width_; }
+    int height() const noexcept { return height_; }
+
+    Color pixel(int x, int y) const
+    {
+        return pixels_[static_cast<size_t>(y) * width_ + x];
+    }
+
+    Color* data() noexcept { return pixels_.data(); }
+
+    std::span<Color> row(int y)
+    {
+        return std::span{pixels_}.subspan(static_cast<size_t>(y) * width_, width_);
+    }
+
+    BoundingBox clip(BoundingBox box) const noexcept
+    {
+        return BoundingBox{std::clamp(box.w, 0, width_), std::clamp(box.h, 0, height_)};
+    }
+
+    // box must be clipped
+    void fill(BoundingBox box, Color color)
+    {
+        for (int y = 0; y < box.h; ++y)
+            std::ranges::fill(row(y).first(box.w), color);
+    }
+
+    void clear(Color color = Color{0, 0, 0})
+    {
+        std::ranges::fill(pixels_, color);
+    }
+
+    bool operator==(const Framebuffer& other) const
+    {
+        return width_ == other.width_ && height_ == other.height_
+            && std::ranges::equal(pixels_, other.pixels_, [](Color a, Color b) { return a.r == b.r && a.g == b.g && a.b == b.b; });
+    }
+};
+
+namespace Rendering
+{
+    constexpr Color default_color{255, 255, 255};
+
+    template <Shape T>
+    Color color_of(const T&) noexcept
+    {
+        return default_color;
+    }
+
+    template <ShapeWithColor T>
+    Color color_of(const T& shp) noexcept
+    {
+        return shp.get_color();
+    }
+
+    // single shape
+    template <Shape T>
+    void render(const T& shp, Framebuffer& fb)
+    {
+        fb.fill(fb.clip(shp.box()), color_of(shp));
+    }
+
+    // boxes of a whole batch are computed and clipped in a tight loop without calls - the loop vectorizes (-O3)
+    template <Shape T>
+    void compute_boxes(std::span<const T> shapes, std::span<BoundingBox> boxes, const Framebuffer& fb)
+    {
+        const int width = fb.width();
+        const int height = fb.height();
+
+        for (size_t i = 0; i < shapes.size(); ++i)
+        {
+            const BoundingBox box = shapes[i].box();
+            boxes[i] = BoundingBox{std::clamp(box.w, 0, width), std::clamp(box.h, 0, height)};
+        }
+    }
+
+    // Color has byte sized members - stores to pixels may alias anything, so all loop invariants are kept in locals
+    template <typename ColorOf>
+    void fill_boxes(Framebuffer& fb, std::span<const BoundingBox> boxes, ColorOf color_of)
+    {
+        Color* const pixels = fb.data();
+        const size_t stride = fb.width();
+
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            const auto [w, h] = boxes[i];
+            const Color color = color_of(i);
+
+            Color* row = pixels;
+            for (int y = 0; y < h; ++y, row += stride)
+                for (int x = 0; x < w; ++x)
+                    row[x] = color;
+        }
+    }
+
+    template <Shape T>
+    void render_batch(std::span<const T> shapes, Framebuffer& fb, std::vector<BoundingBox>& boxes)
+    {
+        boxes.resize(shapes.size());
+        compute_boxes(shapes, std::span{boxes}, fb);
+
+        fill_boxes(fb, boxes, [](size_t) { return default_color; });
+    }
+
+    template <ShapeWithColor T>
+    void render_batch(std::span<const T> shapes, Framebuffer& fb, std::vector<BoundingBox>& boxes)
+    {
+        boxes.resize(shapes.size());
+        compute_boxes(shapes, std::span{boxes}, fb);
+
+        fill_boxes(fb, boxes, [shapes](size_t i) { return shapes[i].get_color(); });
+    }
+
+    /*********************
+    ShapeStore
+    - shapes are grouped by type - one contiguous vector per type
+    - shapes of the same type are drawn in the order of insertion, batches are drawn in the order of TShapes
+      (overlapping shapes of different types may be drawn in a different order than they were added)
+    **********************/
+    template <Shape... TShapes>
+    class ShapeStore
+    {
+        std::tuple<std::vector<TShapes>...> batches_;
+
+    public:
+        template <typename T>
+            requires(std::same_as<std::remove_cvref_t<T>, TShapes> || ...)
+        void add(T&& shp)
+        {
+            std::get<std::vector<std::remove_cvref_t<T>>>(batches_).push_back(std::forward<T>(shp));
+        }
+
+        template <typename T>
+        std::span<const T> batch() const
+        {
+            return std::get<std::vector<T>>(batches_);
+        }
+
+        size_t size() const
+        {
+            return std::apply([](const auto&... batch) { return (batch.size() + ... + 0); }, batches_);
+        }
+
+        template <typename F>
+        void for_each_batch(F f) const
+        {
+            std::apply([&f](const auto&... batch) { (f(std::span{batch}), ...); }, batches_);
+        }
+    };
+
+    template <Shape... TShapes>
+    void render(const ShapeStore<TShapes...>& store, Framebuffer& fb)
+    {
+        std::vector<BoundingBox> boxes; // shared by all batches
+
+        store.for_each_batch([&](auto batch) { render_batch(batch, fb, boxes); });
+    }
+} // namespace Rendering
+
+TEST_CASE("rendering")
+{
+    using namespace Rendering;
+
+    SECTION("single shape is clipped to framebuffer")
+    {
+        Framebuffer fb{4, 3};
+
+        render(ColorRect{10, 2, {0, 255, 0}}, fb);
+
+        CHECK(fb.pixel(3, 1).g == 255);
+        CHECK(fb.pixel(0, 2).g == 0);
+    }
+
+    SECTION("shape without color is drawn with default color")
+    {
+        Framebuffer fb{4, 3};
+
+        render(Rect{1, 1}, fb);
+
+        CHECK(fb.pixel(0, 0).r == default_color.r);
+        CHECK(fb.pixel(1, 0).r == 0);
+    }
+
+    SECTION("batch of shapes gives the same image as shapes rendered one by one")
+    {
+        ShapeStore<Rect, ColorRect> store;
+        std::vector<Rect> rects;
+        std::vector<ColorRect> color_rects;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            rects.push_back(Rect{i % 13, i % 7});
+            color_rects.push_back(ColorRect{i % 11, i % 17, {static_cast<uint8_t>(i), 0, 255}});
+            store.add(rects.back());
+            store.add(color_rects.back());
+        }
+
+        REQUIRE(store.size() == 200);
+        REQUIRE(store.batch<Rect>().size() == 100);
+
+        Framebuffer fb_batch{16, 16};
+        render(store, fb_batch);
+
+        Framebuffer fb_single{16, 16};
+        for (const auto& r : rects)
+            render(r, fb_single);
+        for (const auto& cr : color_rects)
+            render(cr, fb_single);
+
+        CHECK(fb_batch == fb_single);
+    }
+}
+
+namespace Virtual
+{
+    struct Shape
+    {
+        virtual ~Shape() = default;
+        virtual BoundingBox box() const noexcept = 0;
+        virtual void render(Framebuffer& fb) const = 0;
+    };
+
+    struct Rect : Shape
+    {
+        int w, h;
+
+        Rect(int w, int h)
+            : w{w}
+            , h{h}
+        {
+        }
+
+        BoundingBox box() const noexcept override
+        {
+            return BoundingBox{w, h};
+        }
+
+        void render(Framebuffer& fb) const override
+        {
+            fb.fill(fb.clip(box()), Rendering::default_color);
+        }
+    };
+
+    struct ColorRect : Rect
+    {
+        Color color;
+
+        ColorRect(int w, int h, Color color)
+            : Rect{w, h}
+            , color{color}
+        {
+        }
+
+        void render(Framebuffer& fb) const override
+        {
+            fb.fill(fb.clip(box()), color);
+        }
+    };
+} // namespace Virtual
+
+TEST_CASE("rendering - benchmark", "[.benchmark]")
+{
+    constexpr int count = 1'000'000;
+
+    Rendering::ShapeStore<Rect, ColorRect> store;
+    std::vector<std::unique_ptr<Virtual::Shape>> virtual_shapes;
+
+    for (int i = 0; i < count; ++i)
+    {
+        const int w = i % 5 + 1;
+        const int h = i % 3 + 1;
+        const Color color{static_cast<uint8_t>(i), 128, 64};
+
+        if (i % 2 == 0)
+        {
+            store.add(Rect{w, h});
+            virtual_shapes.push_back(std::make_unique<Virtual::Rect>(w, h));
+        }
+        else
+        {
+            store.add(ColorRect{w, h, color});
+            virtual_shapes.push_back(std::make_unique<Virtual::ColorRect>(w, h, color));
+        }
+    }
+
+    Framebuffer fb{64, 64};
+
+    BENCHMARK("virtual - per object render")
+    {
+        for (const auto& shp : virtual_shapes)
+            shp->render(fb);
+        return fb.pixel(0, 0).r;
+    };
+
+    BENCHMARK("concepts - per object render")
+    {
+        for (const auto& r : store.batch<Rect>())
+            Rendering::render(r, fb);
+        for (const auto& cr : store.batch<ColorRect>())
+            Rendering::render(cr, fb);
+        return fb.pixel(0, 0).r;
+    };
+
+    BENCHMARK("concepts - batched render")
+    {
+        Rendering::render(store, fb);
+        return fb.pixel(0, 0).r;
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// spatial index
+
+struct Point
+{
+    int x, y;
+};
+
+// [min, max) - box of width/height 0 contains no points
+struct Bounds
+{
+    int min_x, min_y, max_x, max_y;
+
+    bool contains(Point pt) const noexcept
+    {
+        return min_x <= pt.x && pt.x < max_x && min_y <= pt.y && pt.y < max_y;
+    }
+
+    bool intersects(const Bounds& other) const noexcept
+    {
+        return min_x < other.max_x && other.min_x < max_x && min_y < other.max_y && other.min_y < max_y;
+    }
+};
+
+template <typename T>
+concept PositionedShape = Shape<T> && requires(const T& obj) {
+    { obj.position() } noexcept -> std::same_as<Point>;
+};
+
+struct PlacedRect : Rect
+{
+    Point pos;
+
+    Point position() const noexcept
+    {
+        return pos;
+    }
+};
+
+static_assert(PositionedShape<PlacedRect>);
+
+namespace Spatial
+{
+    template <Shape T>
+    Point position_of(const T&) noexcept
+    {
+        return Point{0, 0};
+    }
+
+    template <PositionedShape T>
+    Point position_of(const T& shp) noexcept
+    {
+        return shp.position();
+    }
+
+    template <Shape T>
+    Bounds bounds_of(const T& shp) noexcept
+    {
+        const auto [x, y] = position_of(shp);
+        const auto [w, h] = shp.box();
+        return Bounds{x, y, x + w, y + h};
+    }
+
+    namespace Details
+    {
+        // position of (x, y) on the Hilbert curve filling 2^16 x 2^16 grid - near points get near indexes
+        inline uint32_t hilbert_index(uint32_t x, uint32_t y)
+        {
+            constexpr uint32_t n = 1u << 16;
+
+            uint32_t index = 0;
+            for (uint32_t s = n / 2; s > 0; s /= 2)
+            {
+                const uint32_t rx = (x & s) > 0;
+                const uint32_t ry = (y & s) > 0;
+                index += s * s * ((3 * rx) ^ ry);
+
+                if (ry == 0)
+                {
+                    if (rx == 1)
+                    {
+                        x = n - 1 - x;
+                        y = n - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+            }
+
+            return index;
+        }
+
+        inline int64_t distance2(const Bounds& bounds, Point pt)
+        {
+            const int64_t dx = std::max({int64_t{bounds.min_x} - pt.x, int64_t{0}, int64_t{pt.x} - bounds.max_x + 1});
+            const int64_t dy = std::max({int64_t{bounds.min_y} - pt.y, int64_t{0}, int64_t{pt.y} - bounds.max_y + 1});
+            return dx * dx + dy * dy;
+        }
+    } // namespace Details
+
+    /*********************
+    PackedRTree
+    - static index bulk-loaded from a range of shapes sorted along the Hilbert curve
+    - nodes have node_size entries, all levels are packed in one array (leaves first, root level last)
+    - coordinates of entries are stored in separate arrays - a node is tested with one branch-free loop
+    - queries return indexes of shapes in the source range
+    **********************/
+    class PackedRTree
+    {
+    public:
+        static constexpr size_t node_size = 16;
+
+    private:
+        std::vector<int> min_x_, min_y_, max_x_, max_y_;
+        std::vector<uint32_t> indexes_; // leaf entry: index of shape, node entry: position of the first child
+        std::vector<size_t> level_ends_;
+
+        Bounds bounds(size_t pos) const noexcept
+        {
+            return Bounds{min_x_[pos], min_y_[pos], max_x_[pos], max_y_[pos]};
+        }
+
+        void push_entry(const Bounds& bounds, uint32_t index)
+        {
+            min_x_.push_back(bounds.min_x);
+            min_y_.push_back(bounds.min_y);
+            max_x_.push_back(bounds.max_x);
+            max_y_.push_back(bounds.max_y);
+            indexes_.push_back(index);
+        }
+
+        size_t node_end(size_t first, size_t level) const noexcept
+        {
+            return std::min(first + node_size, level_ends_[level]);
+        }
+
+        // bit i is set if entry first + i intersects area
+        uint32_t intersecting(size_t first, size_t last, const Bounds& area) const noexcept
+        {
+            uint32_t mask = 0;
+            for (size_t i = first; i < last; ++i)
+            {
+                const bool hit = (min_x_[i] < area.max_x) & (area.min_x < max_x_[i]) & (min_y_[i] < area.max_y) & (area.min_y < max_y_[i]);
+                mask |= uint32_t{hit} << (i - first);
+            }
+            return mask;
+        }
+
+        void build(std::vector<Bounds> items);
+
+    public:
+        PackedRTree() = default;
+
+        template <std::ranges::input_range Rng>
+            requires Shape<std::ranges::range_value_t<Rng>>
+        explicit PackedRTree(Rng&& shapes)
+        {
+            std::vector<Bounds> items;
+            if constexpr (std::ranges::sized_range<Rng>)
+                items.reserve(std::ranges::size(shapes));
+
+            for (const auto& shp : shapes)
+                items.push_back(bounds_of(shp));
+
+            build(std::move(items));
+        }
+
+        size_t size() const noexcept
+        {
+            return level_ends_.empty() ? 0 : level_ends_.front();
+        }
+
+        template <typename F>
+        void query(const Bounds& area, F on_hit) const
+        {
+            if (level_ends_.empty())
+                return;
+
+            std::vector<std::pair<size_t, size_t>> nodes; // first entry, level
+            nodes.emplace_back(level_ends_.size() > 1 ? level_ends_[level_ends_.size() - 2] : 0, level_ends_.size() - 1);
+
+            while (!nodes.empty())
+            {
+                const auto [first, level] = nodes.back();
+                nodes.pop_back();
+
+                for (uint32_t mask = intersecting(first, node_end(first, level), area); mask != 0; mask &= mask - 1)
+                {
+                    const size_t pos = first + std::countr_zero(mask);
+                    if (level == 0)
+                        on_hit(size_t{indexes_[pos]});
+                    else
+                        nodes.emplace_back(indexes_[pos], level - 1);
+                }
+            }
+        }
+
+        std::vector<size_t> query(const Bounds& area) const
+        {
+            std::vector<size_t> result;
+            query(area, [&result](size_t index) { result.push_back(index); });
+            return result;
+        }
+
+        // index of the shape nearest to pt (distance 0 - pt lies inside the shape)
+        std::optional<size_t> nearest(Point pt) const
+        {
+            if (level_ends_.empty())
+                return std::nullopt;
+
+            struct Candidate
+            {
+                int64_t distance2;
+                size_t pos;
+                size_t level;
+
+                bool operator>(const Candidate& other) const noexcept
+                {
+                    return distance2 > other.distance2;
+                }
+            };
+
+            std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> candidates;
+
+            const size_t top_level = level_ends_.size() - 1;
+            const size_t top_first = top_level > 0 ? level_ends_[top_level - 1] : 0;
+            for (size_t pos = top_first; pos < level_ends_[top_level]; ++pos)
+                candidates.push(Candidate{Details::distance2(bounds(pos), pt), pos, top_level});
+
+            while (!candidates.empty())
+            {
+                const auto [distance2, pos, level] = candidates.top();
+                candidates.pop();
+
+                if (level == 0) // no other entry can be closer
+                    return indexes_[pos];
+
+                const size_t first = indexes_[pos];
+                for (size_t child = first; child < node_end(first, level - 1); ++child)
+                    candidates.push(Candidate{Details::distance2(bounds(child), pt), child, level - 1});
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    inline void PackedRTree::build(std::vector<Bounds> items)
+    {
+        if (items.empty())
+            return;
+
+        // sort keys: Hilbert index of the center in upper bits, position of item in lower bits
+        Bounds extent = items.front();
+        for (const Bounds& item : items)
+        {
+            extent.min_x = std::min(extent.min_x, item.min_x);
+            extent.min_y = std::min(extent.min_y, item.min_y);
+            extent.max_x = std::max(extent.max_x, item.max_x);
+            extent.max_y = std::max(extent.max_y, item.max_y);
+        }
+
+        const double scale_x = 65535.0 / std::max(int64_t{1}, int64_t{extent.max_x} - extent.min_x);
+        const double scale_y = 65535.0 / std::max(int64_t{1}, int64_t{extent.max_y} - extent.min_y);
+
+        std::vector<uint64_t> keys(items.size());
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+            const double center_x = (static_cast<double>(items[i].min_x) + items[i].max_x) / 2 - extent.min_x;
+            const double center_y = (static_cast<double>(items[i].min_y) + items[i].max_y) / 2 - extent.min_y;
+            const uint64_t hilbert = Details::hilbert_index(static_cast<uint32_t>(center_x * scale_x), static_cast<uint32_t>(center_y * scale_y));
+            keys[i] = (hilbert << 32) | i;
+        }
+
+        std::ranges::sort(keys);
+
+        size_t entries = items.size();
+        for (size_t count = items.size(); count > node_size; count = (count + node_size - 1) / node_size)
+            entries += (count + node_size - 1) / node_size;
+
+        for (auto* coords : {&min_x_, &min_y_, &max_x_, &max_y_})
+            coords->reserve(entries);
+        indexes_.reserve(entries);
+
+        for (uint64_t key : keys)
+        {
+            const auto index = static_cast<uint32_t>(key);
+            push_entry(items[index], index);
+        }
+        level_ends_.push_back(items.size());
+
+        size_t level_first = 0;
+        while (level_ends_.back() - level_first > node_size)
+        {
+            const size_t level_last = level_ends_.back();
+
+            for (size_t first = level_first; first < level_last; first += node_size)
+            {
+                Bounds node = bounds(first);
+                for (size_t pos = first + 1; pos < std::min(first + node_size, level_last); ++pos)
+                {
+                    node.min_x = std::min(node.min_x, min_x_[pos]);
+                    node.min_y = std::min(node.min_y, min_y_[pos]);
+                    node.max_x = std::max(node.max_x, max_x_[pos]);
+                    node.max_y = std::max(node.max_y, max_y_[pos]);
+                }
+                push_entry(node, static_cast<uint32_t>(first));
+            }
+
+            level_first = level_last;
+            level_ends_.push_back(indexes_.size());
+        }
+    }
+} // namespace Spatial
+
+namespace
+{
+    std::vector<PlacedRect> random_rects(size_t count, int world_size, uint32_t seed = 42)
+    {
+        std::mt19937 rnd{seed};
+        std::uniform_int_distribution<int> coord{0, world_size - 1};
+        std::uniform_int_distribution<int> size{0, 16};
+
+        std::vector<PlacedRect> rects;
+        rects.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            rects.push_back(PlacedRect{{size(rnd), size(rnd)}, {coord(rnd), coord(rnd)}});
+
+        return rects;
+    }
+} // namespace
+
+TEST_CASE("spatial index")
+{
+    using namespace Spatial;
+
+    SECTION("shapes without position are placed at origin")
+    {
+        Bounds b = bounds_of(Rect{10, 20});
+        CHECK((b.min_x == 0 && b.min_y == 0 && b.max_x == 10 && b.max_y == 20));
+
+        Bounds pb = bounds_of(PlacedRect{{10, 20}, {5, 6}});
+        CHECK((pb.min_x == 5 && pb.min_y == 6 && pb.max_x == 15 && pb.max_y == 26));
+    }
+
+    SECTION("empty index")
+    {
+        PackedRTree index{std::vector<Rect>{}};
+
+        CHECK(index.size() == 0);
+        CHECK(index.query(Bounds{0, 0, 100, 100}).empty());
+        CHECK(index.nearest(Point{1, 1}) == std::nullopt);
+    }
+
+    const auto rects = random_rects(10'000, 1000);
+    const PackedRTree index{rects};
+
+    REQUIRE(index.size() == rects.size());
+
+    SECTION("query returns the same shapes as a linear scan")
+    {
+        for (const Bounds& area : {Bounds{0, 0, 50, 50}, Bounds{500, 200, 510, 900}, Bounds{-10, -10, 2000, 2000}, Bounds{3000, 3000, 3001, 3001}})
+        {
+            auto found = index.query(area);
+            std::ranges::sort(found);
+
+            std::vector<size_t> expected;
+            for (size_t i = 0; i < rects.size(); ++i)
+                if (bounds_of(rects[i]).intersects(area))
+                    expected.push_back(i);
+
+            CHECK(found == expected);
+        }
+    }
+
+    SECTION("nearest returns the shape with minimal distance")
+    {
+        for (Point pt : {Point{0, 0}, Point{500, 500}, Point{-100, 333}, Point{999, 2000}})
+        {
+            const auto found = index.nearest(pt);
+            REQUIRE(found.has_value());
+
+            int64_t min_distance = std::numeric_limits<int64_t>::max();
+            for (const auto& r : rects)
+                min_distance = std::min(min_distance, Details::distance2(bounds_of(r), pt));
+
+            CHECK(Details::distance2(bounds_of(rects[*found]), pt) == min_distance);
+        }
+    }
+
+    SECTION("hit test - point inside of a shape")
+    {
+        const auto it = std::ranges::find_if(rects, [](const PlacedRect& r) { return r.w > 0 && r.h > 0; });
+        const auto index_of_hit = static_cast<size_t>(it - rects.begin());
+        const Point pt = it->pos;
+
+        const auto hits = index.query(Bounds{pt.x, pt.y, pt.x + 1, pt.y + 1});
+        CHECK(std::ranges::find(hits, index_of_hit) != hits.end());
+        CHECK(index.nearest(pt).has_value());
+        CHECK(Details::distance2(bounds_of(rects[*index.nearest(pt)]), pt) == 0);
+    }
+}
+
+TEST_CASE("spatial index - benchmark", "[.benchmark]")
+{
+    using namespace Spatial;
+
+    for (size_t count : {1'000'000, 10'000'000})
+    {
+        const int world_size = 100'000;
+        const auto rects = random_rects(count, world_size);
+        const auto suffix = " - "s + std::to_string(count / 1'000'000) + "M shapes";
+
+        std::vector<Bounds> areas;
+        std::vector<Point> points;
+        std::mt19937 rnd{665};
+        std::uniform_int_distribution<int> coord{0, world_size - 1};
+        for (int i = 0; i < 1000; ++i)
+        {
+            const int x = coord(rnd), y = coord(rnd);
+            areas.push_back(Bounds{x, y, x + 200, y + 200});
+            points.push_back(Point{x, y});
+        }
+
+        BENCHMARK("PackedRTree - build" + suffix) { return PackedRTree{rects}.size(); };
+
+        const PackedRTree index{rects};
+
+        BENCHMARK("linear scan - 1 query" + suffix)
+        {
+            size_t hits = 0;
+            for (const auto& r : rects)
+                hits += bounds_of(r).intersects(areas.front());
+            return hits;
+        };
+
+        BENCHMARK("PackedRTree - 1000 queries" + suffix)
+        {
+            size_t hits = 0;
+            for (const auto& area : areas)
+                index.query(area, [&hits](size_t) { ++hits; });
+            return hits;
+        };
+
+        BENCHMARK("PackedRTree - 1000 nearest" + suffix)
+        {
+            size_t sum = 0;
+            for (Point pt : points)
+                sum += *index.nearest(pt);
+            return sum;
+        };
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// packed colors
+
+struct alignas(4) PackedColor
+{
+    uint8_t r, g, b, a = 255;
+
+    PackedColor() = default;
+
+    constexpr PackedColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) noexcept
+        : r{r}
+        , g{g}
+        , b{b}
+        , a{a}
+    {
+    }
+
+    constexpr PackedColor(Color c) noexcept
+        : PackedColor{c.r, c.g, c.b}
+    {
+    }
+
+    constexpr Color rgb() const noexcept
+    {
+        return Color{r, g, b};
+    }
+
+    bool operator==(const PackedColor&) const = default;
+};
+
+static_assert(sizeof(PackedColor) == 4);
+
+/*********************
+ColorBuffer
+- RGBA pixels packed in 4 bytes
+- loops of bulk operations have no calls and no branches - they are vectorized by the compiler
+**********************/
+class ColorBuffer
+{
+    std::vector<PackedColor> pixels_;
+
+    // exact x / 255 for x in [0, 255 * 255]
+    static constexpr uint32_t div255(uint32_t x) noexcept
+    {
+        return (x + 128 + ((x + 128) >> 8)) >> 8;
+    }
+
+public:
+    ColorBuffer() = default;
+
+    explicit ColorBuffer(size_t size, PackedColor color = PackedColor{0, 0, 0})
+        : pixels_(size, color)
+    {
+    }
+
+    size_t size() const noexcept { return pixels_.size(); }
+
+    PackedColor& operator[](size_t index) { return pixels_[index]; }
+    const PackedColor& operator[](size_t index) const { return pixels_[index]; }
+
+    std::span<PackedColor> pixels() noexcept { return pixels_; }
+    std::span<const PackedColor> pixels() const noexcept { return pixels_; }
+
+    void resize(size_t size, PackedColor color = PackedColor{0, 0, 0})
+    {
+        pixels_.resize(size, color);
+    }
+
+    void push_back(PackedColor color)
+    {
+        pixels_.push_back(color);
+    }
+
+    void fill(PackedColor color)
+    {
+        std::ranges::fill(pixels_, color); // 4-byte aligned items - filled like an array of uint32_t
+    }
+
+    // color over pixels with opacity alpha (alpha channel of pixels is left unchanged)
+    void blend(PackedColor color, uint8_t alpha)
+    {
+        const uint32_t src_r = color.r * uint32_t{alpha}, src_g = color.g * uint32_t{alpha}, src_b = color.b * uint32_t{alpha};
+        const uint32_t dst_weight = 255u - alpha;
+
+        for (PackedColor& pixel : pixels_)
+        {
+            pixel.r = static_cast<uint8_t>(div255(src_r + pixel.r * dst_weight));
+            pixel.g = static_cast<uint8_t>(div255(src_g + pixel.g * dst_weight));
+            pixel.b = static_cast<uint8_t>(div255(src_b + pixel.b * dst_weight));
+        }
+    }
+
+    // pixels of other over pixels with opacity alpha
+    void blend(const ColorBuffer& other, uint8_t alpha)
+    {
+        assert(other.size() == size());
+
+        const uint32_t src_weight = alpha;
+        const uint32_t dst_weight = 255u - alpha;
+
+        PackedColor* const pixels = pixels_.data();
+        const PackedColor* const other_pixels = other.pixels_.data();
+        for (size_t i = 0; i < pixels_.size(); ++i)
+        {
+            pixels[i].r = static_cast<uint8_t>(div255(other_pixels[i].r * src_weight + pixels[i].r * dst_weight));
+            pixels[i].g = static_cast<uint8_t>(div255(other_pixels[i].g * src_weight + pixels[i].g * dst_weight));
+            pixels[i].b = static_cast<uint8_t>(div255(other_pixels[i].b * src_weight + pixels[i].b * dst_weight));
+        }
+    }
+
+    // luma with weights of BT.601 in 8-bit fixed point
+    void grayscale()
+    {
+        for (PackedColor& pixel : pixels_)
+        {
+            const auto y = static_cast<uint8_t>((77u * pixel.r + 150u * pixel.g + 29u * pixel.b + 128u) >> 8);
+            pixel.r = pixel.g = pixel.b = y;
+        }
+    }
+
+    void to_planar(std::span<uint8_t> r, std::span<uint8_t> g, std::span<uint8_t> b) const
+    {
+        assert(r.size() == size() && g.size() == size() && b.size() == size());
+
+        const PackedColor* const pixels = pixels_.data();
+        for (size_t i = 0; i < pixels_.size(); ++i)
+        {
+            r[i] = pixels[i].r;
+            g[i] = pixels[i].g;
+            b[i] = pixels[i].b;
+        }
+    }
+
+    void from_planar(std::span<const uint8_t> r, std::span<const uint8_t> g, std::span<const uint8_t> b)
+    {
+        assert(r.size() == g.size() && r.size() == b.size());
+
+        pixels_.resize(r.size());
+        PackedColor* const pixels = pixels_.data();
+        for (size_t i = 0; i < pixels_.size(); ++i)
+            pixels[i] = PackedColor{r[i], g[i], b[i]};
+    }
+
+    bool operator==(const ColorBuffer&) const = default;
+};
+
+/*********************
+ColorRects
+- bulk storage of color rectangles: geometry and colors are kept in separate arrays
+- operator[] returns a reference object which models ShapeWithColor
+- all rectangles are recolored with bulk operations of colors()
+**********************/
+class ColorRects
+{
+    std::vector<Rect> rects_;
+    ColorBuffer colors_;
+
+public:
+    class reference
+    {
+        Rect* rect_;
+        PackedColor* color_;
+
+    public:
+        reference(Rect& rect, PackedColor& color)
+            : rect_{&rect}
+            , color_{&color}
+        {
+        }
+
+        void draw() const { rect_->draw(); }
+        BoundingBox box() const noexcept { return rect_->box(); }
+
+        Color get_color() const noexcept { return color_->rgb(); }
+        void set_color(Color new_color) const noexcept { *color_ = PackedColor{new_color}; }
+    };
+
+    void push_back(const ColorRect& cr)
+    {
+        rects_.push_back(cr);
+        colors_.push_back(PackedColor{cr.color});
+    }
+
+    size_t size() const noexcept { return rects_.size(); }
+
+    reference operator[](size_t index)
+    {
+        return reference{rects_[index], colors_[index]};
+    }
+
+    ColorBuffer& colors() noexcept { return colors_; }
+    const ColorBuffer& colors() const noexcept { return colors_; }
+};
+
+static_assert(ShapeWithColor<ColorRects::reference>);
+
+TEST_CASE("packed colors")
+{
+    ColorBuffer buffer(7, PackedColor{10, 20, 30});
+
+    SECTION("fill")
+    {
+        buffer.fill(PackedColor{1, 2, 3, 4});
+
+        CHECK(std::ranges::all_of(buffer.pixels(), [](PackedColor c) { return c == PackedColor{1, 2, 3, 4}; }));
+    }
+
+    SECTION("blend with color")
+    {
+        buffer.blend(PackedColor{255, 255, 255}, 255);
+        CHECK(buffer[6] == PackedColor{255, 255, 255});
+
+        buffer.blend(PackedColor{0, 0, 0}, 0);
+        CHECK(buffer[6] == PackedColor{255, 255, 255});
+
+        buffer.blend(PackedColor{0, 0, 0}, 128);
+        CHECK(buffer[0] == PackedColor{127, 127, 127});
+    }
+
+    SECTION("blend with buffer")
+    {
+        ColorBuffer other(7, PackedColor{110, 120, 130, 0});
+
+        buffer.blend(other, 51);
+
+        CHECK(buffer[3] == PackedColor{30, 40, 50, 255});
+    }
+
+    SECTION("grayscale")
+    {
+        buffer[0] = PackedColor{255, 255, 255};
+        buffer[1] = PackedColor{255, 0, 0};
+
+        buffer.grayscale();
+
+        CHECK(buffer[0] == PackedColor{255, 255, 255});
+        CHECK(buffer[1] == PackedColor{77, 77, 77});
+    }
+
+    SECTION("planar conversion - round trip")
+    {
+        for (size_t i = 0; i < buffer.size(); ++i)
+            buffer[i] = PackedColor{static_cast<uint8_t>(i), static_cast<uint8_t>(2 * i), static_cast<uint8_t>(3 * i)};
+
+        std::vector<uint8_t> r(buffer.size()), g(buffer.size()), b(buffer.size());
+        buffer.to_planar(r, g, b);
+
+        CHECK(g[5] == 10);
+
+        ColorBuffer converted;
+        converted.from_planar(r, g, b);
+
+        CHECK(converted == buffer);
+    }
+
+    SECTION("bulk stored color rectangles")
+    {
+        ColorRects rects;
+        rects.push_back(ColorRect{10, 20, {0, 255, 0}});
+        rects.push_back(ColorRect{30, 40, {255, 0, 0}});
+
+        auto second = rects[1];
+        render(second); // render<ShapeWithColor T>
+        CHECK(rects[1].get_color().r == 0);
+        CHECK(rects[0].get_color().g == 255);
+
+        rects.colors().fill(PackedColor{1, 2, 3});
+        CHECK(rects[0].get_color().b == 3);
+    }
+}
+
+TEST_CASE("packed colors - benchmark", "[.benchmark]")
+{
+    constexpr size_t count = 100'000'000;
+    const Color new_color{12, 34, 56};
+
+    {
+        std::vector<ColorRect> shapes(count, ColorRect{10, 20, {0, 255, 0}});
+
+        BENCHMARK("ColorRect - set_color per object")
+        {
+            for (auto& shp : shapes)
+                shp.set_color(new_color);
+            return shapes.back().color.r;
+        };
+    }
+
+    ColorBuffer buffer(count, PackedColor{0, 255, 0});
+
+    BENCHMARK("ColorBuffer - fill")
+    {
+        buffer.fill(PackedColor{new_color});
+        return buffer[count - 1].r;
+    };
+
+    BENCHMARK("ColorBuffer - blend")
+    {
+        buffer.blend(PackedColor{new_color}, 100);
+        return buffer[count - 1].r;
+    };
+
+    BENCHMARK("ColorBuffer - grayscale")
+    {
+        buffer.grayscale();
+        return buffer[count - 1].r;
+    };
+}
@@ -1,4 +1,9 @@
+#include <algorithms.hpp>
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cmath>
 #include <concepts>
 #include <forward_list>
 #include <iostream>
@@ -222,6 +227,82 @@ TEST_CASE("")
     CHECK(sum(vec) == 15);
 }
 
+template <AdditiveRange Rng>
+    requires std::default_initializable<std::ranges::range_value_t<Rng>>
+        && std::ranges::contiguous_range<Rng> && helpers::algorithms::Arithmetic<std::ranges::range_value_t<Rng>>
+auto sum(const Rng& data)
+{
+    return helpers::algorithms::sum(data);
+}
+
+template <AdditiveRange Rng>
+    requires std::default_initializable<std::ranges::range_value_t<Rng>>
+        && std::ranges::contiguous_range<Rng> && helpers::algorithms::Arithmetic<std::ranges::range_value_t<Rng>>
+auto sum(const Rng& data, helpers::algorithms::Summation summation)
+{
+    return helpers::algorithms::sum(data, summation);
+}
+
+TEST_CASE("sum - overloads for contiguous ranges of numbers")
+{
+    using helpers::algorithms::Summation;
+
+    SECTION("generic version for other ranges")
+    {
+        std::list lst = {1, 2, 3};
+        CHECK(sum(lst) == 6);
+
+        std::vector words = {"a"s, "b"s};
+        CHECK(sum(words) == "ab");
+    }
+
+    SECTION("integers")
+    {
+        std::vector<int> vec(10'001);
+        std::iota(vec.begin(), vec.end(), -5'000);
+        CHECK(sum(vec) == 0);
+
+        std::array<long, 3> arr = {1, 2, 3};
+        CHECK(sum(arr) == 6);
+    }
+
+    SECTION("floating points")
+    {
+        const std::vector<float> vec(10'000'000, 0.1f);
+        const double expected = 10'000'000 * static_cast<double>(0.1f);
+
+        CHECK(std::abs(sum(vec, Summation::kahan) - expected) < 0.1); // less than ulp(1e6f)
+        CHECK(std::abs(sum(vec, Summation::pairwise) - expected) < 1.0);
+        CHECK(std::abs(std::accumulate(vec.begin(), vec.end(), 0.0f) - expected) > 1'000.0); // serial float sum drifts
+    }
+
+    SECTION("splitting across threads")
+    {
+        std::vector<int> vec(4'000'003, 1);
+
+        CHECK(helpers::algorithms::parallel_sum<int>(vec, Summation::simple, 4) == 4'000'003);
+
+        std::vector<double> values(4'000'003, 0.5);
+        CHECK(helpers::algorithms::parallel_sum<double>(values, Summation::kahan, 3) == 2'000'001.5);
+    }
+}
+
+TEST_CASE("sum - benchmark", "[.benchmark]")
+{
+    using helpers::algorithms::Summation;
+
+    for (size_t size : {1'000ULL, 1'000'000ULL, 1'000'000'000ULL})
+    {
+        const std::vector<float> data(size, 0.1f);
+        const auto suffix = " - " + std::to_string(size);
+
+        BENCHMARK("std::accumulate" + suffix) { return std::accumulate(data.begin(), data.end(), 0.0f); };
+        BENCHMARK("sum" + suffix) { return sum(data); };
+        BENCHMARK("sum - kahan" + suffix) { return sum(data, Summation::kahan); };
+        BENCHMARK("sum - pairwise" + suffix) { return sum(data, Summation::pairwise); };
+    }
+}
+
 ///////////////////////////////////////////
 
 template <typename T>
@@ -0,0 +1,73 @@
+#ifndef TASK_RESUMER_HPP
+#define TASK_RESUMER_HPP
+
+#include <coroutine>
+#include <exception>
+
+class TaskResumer
+{
+public:
+    struct promise_type
+    {
+        int value_;
+
+        TaskResumer get_return_object()
+        {
+            return TaskResumer{std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+        
+        auto initial_suspend() -> std::suspend_always
+        {
+            return {};
+        }
+        
+        auto final_suspend() noexcept -> std::suspend_always
+        {
+            return {};
+        }
+
+        void return_value(auto expr)
+        {
+            value_ = expr;
+        }
+
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+public:
+    TaskResumer(std::coroutine_handle<promise_type> coro_hndl) : coro_hndl_{coro_hndl}
+    {}
+
+    TaskResumer(const TaskResumer&) = delete;
+    TaskResumer& operator=(const TaskResumer&) = delete;
+    TaskResumer(TaskResumer&&) = delete;
+    TaskResumer& operator=(TaskResumer&&) = delete;
+
+    ~TaskResumer() 
+    {
+        if (coro_hndl_)
+            coro_hndl_.destroy();
+    }
+
+    bool resume() const
+    {
+         if (!coro_hndl_ || coro_hndl_.done())
+            return false;
+
+        coro_hndl_.resume(); // resuming suspended coroutine
+
+        return !coro_hndl_.done();
+    }
+
+    int get_value() 
+    {
+        return coro_hndl_.promise().value_;
+    }
+
+private:
+    std::coroutine_handle<promise_type> coro_hndl_;
+};
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef AGGREGATE_HPP
+#define AGGREGATE_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace helpers
+{
+    /*********************
+    Introspection of aggregates with structured bindings
+    - aggregate_member_count<T>() - number of members (up to 8) detected with brace initialization
+    - IntrospectableAggregate<T> - false for aggregates whose members cannot be bound: more than 8 members,
+      base classes or array members (brace elision counts array elements, not members) - such types
+      must list their members explicitly
+    - apply_to_members(obj, f) - calls f with references to all members of obj
+    - tie_members(obj) - std::tie of all members of obj
+    **********************/
+
+    namespace Details
+    {
+        struct AnyField
+        {
+            template <typename T>
+            operator T&() const;
+        };
+
+        // converts only to base classes of TAggregate - initializes the first element iff it is a base
+        template <typename TAggregate>
+        struct AnyBase
+        {
+            template <typename T>
+                requires std::is_base_of_v<T, TAggregate> && (!std::is_same_v<T, TAggregate>)
+            operator T&() const;
+        };
+
+        template <typename T, size_t... I>
+        constexpr bool brace_constructible_with(std::index_sequence<I...>)
+        {
+            return requires { T{(static_cast<void>(I), AnyField{})...}; };
+        }
+
+        // every {} initializes a whole member - no brace elision into array members
+        template <typename T, size_t N>
+        constexpr bool member_wise_constructible()
+        {
+            // clang-format off
+            if constexpr (N == 1) return requires { T{{}}; };
+            else if constexpr (N == 2) return requires { T{{}, {}}; };
+            else if constexpr (N == 3) return requires { T{{}, {}, {}}; };
+            else if constexpr (N == 4) return requires { T{{}, {}, {}, {}}; };
+            else if constexpr (N == 5) return requires { T{{}, {}, {}, {}, {}}; };
+            else if constexpr (N == 6) return requires { T{{}, {}, {}, {}, {}, {}}; };
+            else if constexpr (N == 7) return requires { T{{}, {}, {}, {}, {}, {}, {}}; };
+            else return requires { T{{}, {}, {}, {}, {}, {}, {}, {}}; };
+            // clang-format on
+        }
+
+        constexpr size_t max_aggregate_members = 8;
+
+        // 0 if T takes more than max_aggregate_members initializers
+        template <typename T, size_t N = max_aggregate_members + 1>
+        constexpr size_t aggregate_member_count()
+        {
+            if constexpr (N == 0)
+                return 0;
+            else if constexpr (brace_constructible_with<T>(std::make_index_sequence<N>{}))
+                return N > max_aggregate_members ? 0 : N;
+            else
+                return aggregate_member_count<T, N - 1>();
+        }
+
+        // structured bindings need exactly as many names as there are members declared in T itself
+        template <typename T>
+        constexpr bool has_bindable_members()
+        {
+            constexpr size_t count = aggregate_member_count<T>();
+
+            if constexpr (count == 0 || brace_constructible_with<T>(std::make_index_sequence<count + 1>{}))
+                return false;
+            else if constexpr (requires { T{AnyBase<T>{}}; })
+                return false;
+            else
+                return member_wise_constructible<T, count>();
+        }
+
+        template <typename T>
+        concept IntrospectableAggregate = std::is_aggregate_v<std::remove_cv_t<T>> && !std::is_array_v<T>
+            && has_bindable_members<std::remove_cv_t<T>>();
+
+        template <IntrospectableAggregate T, typename F>
+        decltype(auto) apply_to_members(T& obj, F&& f)
+        {
+            constexpr size_t count = aggregate_member_count<std::remove_cv_t<T>>();
+
+            // clang-format off
+            if constexpr (count == 1) { auto& [m1] = obj; return f(m1); }
+            else if constexpr (count == 2) { auto& [m1, m2] = obj; return f(m1, m2); }
+            else if constexpr (count == 3) { auto& [m1, m2, m3] = obj; return f(m1, m2, m3); }
+            else if constexpr (count == 4) { auto& [m1, m2, m3, m4] = obj; return f(m1, m2, m3, m4); }
+            else if constexpr (count == 5) { auto& [m1, m2, m3, m4, m5] = obj; return f(m1, m2, m3, m4, m5); }
+            else if constexpr (count == 6) { auto& [m1, m2, m3, m4, m5, m6] = obj; return f(m1, m2, m3, m4, m5, m6); }
+            else if constexpr (count == 7) { auto& [m1, m2, m3, m4, m5, m6, m7] = obj; return f(m1, m2, m3, m4, m5, m6, m7); }
+            else { auto& [m1, m2, m3, m4, m5, m6, m7, m8] = obj; return f(m1, m2, m3, m4, m5, m6, m7, m8); }
+            // clang-format on
+        }
+
+        template <IntrospectableAggregate T>
+        auto tie_members(T& obj)
+        {
+            return apply_to_members(obj, [](auto&... members) { return std::tie(members...); });
+        }
+    } // namespace Details
+} // namespace helpers
+
+#endif
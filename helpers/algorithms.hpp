@@ -0,0 +1,509 @@
+#ifndef ALGORITHMS_HPP
+#define ALGORITHMS_HPP
+
+#include "bits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HELPERS_ALGORITHMS_SSE2
+#endif
+
+namespace helpers::algorithms
+{
+    /*********************
+    Implementation is selected with concept subsumption:
+    1. generic version - any forward range (node based containers, proxy ranges)
+    2. std::vector<bool> - operations on whole words of bits
+    3. contiguous range of trivially copyable items - memset/memcpy/memchr or vectorizable loops
+       - zero/fill of buffers larger than the last level cache are split between threads & written with
+         non-temporal (streaming) stores that bypass the cache
+       - sum of numbers in lanes of independent accumulators, split between threads for large inputs;
+         sum(rng, Summation::kahan / pairwise) bounds the rounding error of floating point sums
+    **********************/
+
+    template <typename Rng>
+    concept TrivialContiguousRange = std::ranges::contiguous_range<Rng> && std::ranges::sized_range<Rng>
+        && std::is_trivially_copyable_v<std::ranges::range_value_t<Rng>>;
+
+    template <typename Rng>
+    concept BitVector = std::same_as<std::remove_cvref_t<Rng>, std::vector<bool>>;
+
+    template <typename T>
+    concept ZeroBitPattern = std::is_scalar_v<T> && !std::is_member_pointer_v<T>; // T{} is represented by all bits set to zero
+
+    template <typename T>
+    concept ByteLike = sizeof(T) == 1 && (std::integral<T> || std::same_as<T, std::byte>);
+
+    template <typename T>
+    concept Arithmetic = (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>;
+
+    template <typename T, typename TValue>
+    concept LosslessComparable = std::same_as<T, TValue> || (Arithmetic<T> && std::integral<T> && std::integral<TValue>);
+
+    enum class Summation
+    {
+        simple,   // independent partial sums - fastest, rounding error grows with size
+        kahan,    // compensated summation - error independent of size
+        pairwise, // recursive halving - error grows with log(size)
+    };
+
+    namespace Details
+    {
+        template <typename T>
+        bool has_zero_bit_pattern(const T& value)
+        {
+            std::array<std::byte, sizeof(T)> bytes;
+            std::memcpy(bytes.data(), &value, sizeof(T));
+            return std::ranges::all_of(bytes, [](std::byte b) { return b == std::byte{0}; });
+        }
+
+        // std::in_range for any pair of integral types - character types & bool are compared as their promoted values
+        template <std::integral R, std::integral T>
+        constexpr bool fits_in(T value) noexcept
+        {
+            return std::cmp_greater_equal(+value, +std::numeric_limits<R>::min()) && std::cmp_less_equal(+value, +std::numeric_limits<R>::max());
+        }
+
+        // independent partial sums break the dependency chain of a single accumulator - the loop vectorizes
+        template <Arithmetic T>
+        T sum_lanes(const T* data, size_t size)
+        {
+            constexpr size_t lanes = 64 / sizeof(T); // one cache line (or AVX-512 register) per step
+
+            std::array<T, lanes> partial_sums{};
+
+            size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    partial_sums[lane] += data[i + lane];
+
+            T result = std::accumulate(partial_sums.begin(), partial_sums.end(), T{});
+            for (; i < size; ++i)
+                result += data[i];
+
+            return result;
+        }
+
+        // Kahan summation in lanes - must not be compiled with -ffast-math
+        template <std::floating_point T>
+        T sum_kahan(const T* data, size_t size)
+        {
+            constexpr size_t lanes = 64 / sizeof(T);
+
+            std::array<T, lanes> sums{};
+            std::array<T, lanes> compensations{};
+
+            auto add = [](T& sum, T& compensation, T value) {
+                const T y = value - compensation;
+                const T t = sum + y;
+                compensation = (t - sum) - y; // lost low-order bits of y
+                sum = t;
+            };
+
+            size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    add(sums[lane], compensations[lane], data[i + lane]);
+
+            T sum{};
+            T compensation{};
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                add(sum, compensation, sums[lane]);
+                add(sum, compensation, -compensations[lane]);
+            }
+            for (; i < size; ++i)
+                add(sum, compensation, data[i]);
+
+            return sum;
+        }
+
+        template <Arithmetic T>
+        T sum_pairwise(const T* data, size_t size)
+        {
+            constexpr size_t block_size = 1024;
+
+            if (size <= block_size)
+                return sum_lanes(data, size);
+
+            const size_t half = size / 2;
+            return sum_pairwise(data, half) + sum_pairwise(data + half, size - half);
+        }
+
+        template <Arithmetic T>
+        T sum_serial(const T* data, size_t size, Summation summation)
+        {
+            if constexpr (std::floating_point<T>)
+            {
+                switch (summation)
+                {
+                    case Summation::kahan:
+                        return sum_kahan(data, size);
+                    case Summation::pairwise:
+                        return sum_pairwise(data, size);
+                    default:
+                        break;
+                }
+            }
+
+            return sum_lanes(data, size); // integer sums are exact for every summation
+        }
+
+        inline size_t hardware_thread_count()
+        {
+            static const size_t thread_count = std::max(1u, std::thread::hardware_concurrency()); // query is a syscall
+            return thread_count;
+        }
+
+        // blocks are checked with a branch-free 'any' reduction - the position is searched only in a matching block
+        template <Arithmetic T>
+        size_t find_index(const T* data, size_t size, T value)
+        {
+            constexpr size_t block_size = 64 / sizeof(T);
+
+            size_t i = 0;
+            for (; i + block_size <= size; i += block_size)
+            {
+                bool found = false;
+                for (size_t j = 0; j < block_size; ++j)
+                    found |= (data[i + j] == value);
+
+                if (found)
+                    break;
+            }
+
+            for (; i < size; ++i)
+                if (data[i] == value)
+                    return i;
+
+            return size;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // fill of large buffers
+
+        // buffers that do not fit in the last level cache - regular stores would only evict useful data
+        constexpr size_t streaming_threshold = 32 * 1024 * 1024;
+        constexpr size_t min_bytes_per_thread = 8 * 1024 * 1024;
+        constexpr size_t page_size = 4096;
+
+        // value repeated in a 16-byte vector - stores start at a 16-byte aligned address that is an item boundary
+        template <typename T>
+        concept StreamablePattern = std::is_trivially_copyable_v<T> && (16 % sizeof(T) == 0);
+
+        template <StreamablePattern T>
+        void stream_fill(T* data, size_t size, const T& value)
+        {
+#ifdef HELPERS_ALGORITHMS_SSE2
+            auto address = reinterpret_cast<std::uintptr_t>(data);
+
+            if (address % sizeof(T) != 0) // items are never 16-byte aligned
+            {
+                std::fill_n(data, size, value);
+                return;
+            }
+
+            const size_t head = std::min(size, ((16 - address % 16) % 16) / sizeof(T));
+            std::fill_n(data, head, value);
+
+            constexpr size_t items_per_vector = 16 / sizeof(T);
+
+            alignas(16) unsigned char pattern[16];
+            for (size_t i = 0; i < items_per_vector; ++i)
+                std::memcpy(pattern + i * sizeof(T), &value, sizeof(T));
+            const __m128i vector = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+            const size_t vectors = (size - head) / items_per_vector;
+
+            auto* dest = reinterpret_cast<__m128i*>(data + head);
+            for (size_t i = 0; i < vectors; ++i)
+                _mm_stream_si128(dest + i, vector);
+            _mm_sfence(); // streaming stores are weakly ordered
+
+            const size_t done = head + vectors * items_per_vector;
+            std::fill_n(data + done, size - done, value);
+#else
+            std::fill_n(data, size, value);
+#endif
+        }
+
+        // chunks start at page boundaries - each thread fills whole pages of its own chunk; with the first-touch
+        // policy of the OS (Linux, Windows) fresh pages are placed on the NUMA node of the thread that uses them first
+        // (only a page with an item that straddles a chunk boundary is shared)
+        template <typename T, std::invocable<size_t, size_t> F>
+        void for_each_page_chunk(const T* data, size_t size, F f)
+        {
+            const size_t size_bytes = size * sizeof(T);
+            const size_t thread_count = std::clamp<size_t>(size_bytes / min_bytes_per_thread, 1, hardware_thread_count());
+            const size_t chunk_bytes = (size_bytes / thread_count + page_size - 1) / page_size * page_size;
+
+            const auto address = reinterpret_cast<std::uintptr_t>(data);
+
+            // index of the first item at or after the page boundary that follows offset_bytes
+            auto item_at_page_boundary = [=](size_t offset_bytes) {
+                const std::uintptr_t page_start = (address + offset_bytes + page_size - 1) / page_size * page_size;
+                return std::min(size, static_cast<size_t>(page_start - address + sizeof(T) - 1) / sizeof(T));
+            };
+
+            const size_t first_chunk_end = item_at_page_boundary(chunk_bytes);
+
+            std::vector<std::jthread> threads;
+            threads.reserve(thread_count - 1);
+            for (size_t first = first_chunk_end, offset = 2 * chunk_bytes; first < size; offset += chunk_bytes)
+            {
+                const size_t last = item_at_page_boundary(offset);
+                threads.emplace_back([=, &f] { f(first, last - first); });
+                first = last;
+            }
+
+            f(size_t{0}, first_chunk_end);
+        }
+
+        template <typename T>
+        void parallel_fill(T* data, size_t size, const T& value)
+        {
+            for_each_page_chunk(data, size, [=, &value](size_t first, size_t count) {
+                if constexpr (StreamablePattern<T>)
+                    stream_fill(data + first, count, value);
+                else
+                    std::fill_n(data + first, count, value);
+            });
+        }
+    } // namespace Details
+
+    ////////////////////////////////////////////////////////////////////////
+    // zero
+
+    template <typename Rng>
+    concept ZeroableRange = std::ranges::forward_range<Rng> && std::default_initializable<std::ranges::range_value_t<Rng>>;
+
+    template <ZeroableRange Rng>
+    void zero(Rng&& rng)
+    {
+        using TValue = std::ranges::range_value_t<Rng>;
+
+        for (auto&& item : rng)
+            item = TValue{};
+    }
+
+    template <ZeroableRange Rng>
+        requires BitVector<Rng>
+    void zero(Rng&& rng)
+    {
+        bits::fill(rng, false);
+    }
+
+    template <ZeroableRange Rng>
+        requires TrivialContiguousRange<Rng> && ZeroBitPattern<std::ranges::range_value_t<Rng>>
+    void zero(Rng&& rng)
+    {
+        const size_t size_bytes = std::ranges::size(rng) * sizeof(std::ranges::range_value_t<Rng>);
+        auto* bytes = reinterpret_cast<unsigned char*>(std::ranges::data(rng));
+
+        if (size_bytes < Details::streaming_threshold)
+            std::memset(bytes, 0, size_bytes);
+        else
+            Details::parallel_fill(bytes, size_bytes, static_cast<unsigned char>(0));
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // fill
+
+    template <typename Rng, typename T>
+    concept FillableRange = std::ranges::forward_range<Rng> && requires(std::ranges::iterator_t<Rng> it, const T& value) {
+        *it = value; // proxy references (std::vector<bool>) are accepted
+    };
+
+    template <typename T, FillableRange<T> Rng>
+    void fill(Rng&& rng, const T& value)
+    {
+        for (auto&& item : rng)
+            item = value;
+    }
+
+    template <typename T, FillableRange<T> Rng>
+        requires BitVector<Rng>
+    void fill(Rng&& rng, const T& value)
+    {
+        bits::fill(rng, static_cast<bool>(value));
+    }
+
+    template <typename T, FillableRange<T> Rng>
+        requires TrivialContiguousRange<Rng>
+    void fill(Rng&& rng, const T& value)
+    {
+        using TValue = std::ranges::range_value_t<Rng>;
+
+        const TValue fill_value = value;
+        TValue* const data = std::ranges::data(rng);
+        const size_t size = std::ranges::size(rng);
+
+        if (size * sizeof(TValue) >= Details::streaming_threshold)
+            Details::parallel_fill(data, size, fill_value);
+        else if constexpr (ByteLike<TValue>)
+            std::memset(data, static_cast<unsigned char>(fill_value), size);
+        else
+        {
+            if (Details::has_zero_bit_pattern(fill_value))
+                std::memset(data, 0, size * sizeof(TValue));
+            else
+                std::fill_n(data, size, fill_value);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // copy
+
+    template <std::ranges::input_range InRng, std::weakly_incrementable Out>
+        requires std::indirectly_copyable<std::ranges::iterator_t<InRng>, Out>
+    Out copy(InRng&& in, Out out)
+    {
+        for (auto&& item : in)
+        {
+            *out = item;
+            ++out;
+        }
+
+        return out;
+    }
+
+    template <std::ranges::input_range InRng, std::weakly_incrementable Out>
+        requires std::indirectly_copyable<std::ranges::iterator_t<InRng>, Out>
+        && TrivialContiguousRange<InRng> && std::contiguous_iterator<Out>
+        && std::same_as<std::ranges::range_value_t<InRng>, std::iter_value_t<Out>>
+    Out copy(InRng&& in, Out out)
+    {
+        const auto size = std::ranges::size(in);
+
+        if (size != 0) // memmove - source and destination may overlap like in std::copy
+            std::memmove(std::to_address(out), std::ranges::data(in), size * sizeof(std::ranges::range_value_t<InRng>));
+
+        return out + size;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // sum
+
+    template <typename T>
+    concept Addable = requires(T a, T b) { a + b; };
+
+    template <typename Rng>
+    concept AdditiveRange = std::ranges::input_range<Rng> && Addable<std::ranges::range_value_t<Rng>>
+        && std::default_initializable<std::ranges::range_value_t<Rng>>;
+
+    template <AdditiveRange Rng>
+    auto sum(Rng&& rng)
+    {
+        return std::accumulate(std::ranges::begin(rng), std::ranges::end(rng), std::ranges::range_value_t<Rng>{});
+    }
+
+    // large inputs are split into chunks summed on separate threads
+    template <Arithmetic T>
+    T parallel_sum(std::span<const T> data, Summation summation = Summation::simple, size_t max_threads = Details::hardware_thread_count())
+    {
+        constexpr size_t min_chunk_size = 1 << 20;
+
+        const size_t thread_count = std::min(max_threads, data.size() / min_chunk_size);
+
+        if (thread_count <= 1)
+            return Details::sum_serial(data.data(), data.size(), summation);
+
+        std::vector<T> partial_sums(thread_count);
+        {
+            const size_t chunk_size = data.size() / thread_count;
+
+            std::vector<std::jthread> threads;
+            threads.reserve(thread_count);
+            for (size_t i = 0; i < thread_count; ++i)
+            {
+                auto chunk = (i + 1 == thread_count) ? data.subspan(i * chunk_size) : data.subspan(i * chunk_size, chunk_size);
+                threads.emplace_back([&partial_sum = partial_sums[i], chunk, summation] {
+                    partial_sum = Details::sum_serial(chunk.data(), chunk.size(), summation);
+                });
+            }
+        } // threads are joined
+
+        return Details::sum_serial(partial_sums.data(), partial_sums.size(), summation);
+    }
+
+    // Note: for floating point types the order of additions differs from std::accumulate
+    template <AdditiveRange Rng>
+        requires TrivialContiguousRange<Rng> && Arithmetic<std::ranges::range_value_t<Rng>>
+    auto sum(Rng&& rng)
+    {
+        using T = std::ranges::range_value_t<Rng>;
+        return parallel_sum(std::span<const T>{std::ranges::data(rng), std::ranges::size(rng)});
+    }
+
+    template <AdditiveRange Rng>
+        requires TrivialContiguousRange<Rng> && Arithmetic<std::ranges::range_value_t<Rng>>
+    auto sum(Rng&& rng, Summation summation)
+    {
+        using T = std::ranges::range_value_t<Rng>;
+        return parallel_sum(std::span<const T>{std::ranges::data(rng), std::ranges::size(rng)}, summation);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // find
+
+    template <std::ranges::input_range Rng, typename T>
+        requires std::equality_comparable_with<std::ranges::range_reference_t<Rng>, const T&>
+    std::ranges::borrowed_iterator_t<Rng> find(Rng&& rng, const T& value)
+    {
+        return std::ranges::find(rng, value);
+    }
+
+    template <std::ranges::input_range Rng, typename T>
+        requires std::equality_comparable_with<std::ranges::range_reference_t<Rng>, const T&>
+        && BitVector<Rng> && std::same_as<T, bool>
+    std::ranges::borrowed_iterator_t<Rng> find(Rng&& rng, const T& value)
+    {
+        return bits::find(rng, value);
+    }
+
+    template <std::ranges::input_range Rng, typename T>
+        requires std::equality_comparable_with<std::ranges::range_reference_t<Rng>, const T&>
+        && TrivialContiguousRange<Rng> && Arithmetic<std::ranges::range_value_t<Rng>>
+        && LosslessComparable<T, std::ranges::range_value_t<Rng>>
+    std::ranges::borrowed_iterator_t<Rng> find(Rng&& rng, const T& value)
+    {
+        using TValue = std::ranges::range_value_t<Rng>;
+
+        const auto* data = std::ranges::data(rng);
+        const size_t size = std::ranges::size(rng);
+
+        if constexpr (!std::same_as<T, TValue>) // value that cannot be stored in TValue is never found
+        {
+            if (!Details::fits_in<TValue>(value))
+                return std::ranges::next(std::ranges::begin(rng), size);
+        }
+
+        size_t index;
+        if constexpr (ByteLike<TValue>)
+        {
+            const void* pos = std::memchr(data, static_cast<unsigned char>(value), size);
+            index = pos ? static_cast<const unsigned char*>(pos) - reinterpret_cast<const unsigned char*>(data) : size;
+        }
+        else
+            index = Details::find_index(data, size, static_cast<TValue>(value));
+
+        return std::ranges::next(std::ranges::begin(rng), index);
+    }
+} // namespace helpers::algorithms
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace helpers
+{
+    /*********************
+    Arena allocation for transient containers
+    - StackArena<Size> - buffer of Size bytes (e.g. on the stack) managed by std::pmr::monotonic_buffer_resource;
+      allocations beyond the buffer go to the upstream resource (heap by default), deallocation is a no-op,
+      memory is reclaimed all at once by release() or the destructor
+    - ArenaAllocator<T> - allocator using a std::pmr::memory_resource at runtime; during constant evaluation
+      (or without a resource) it degrades to std::allocator<T> - constexpr functions may use it
+      (std::pmr::polymorphic_allocator is not constexpr)
+    - containers must not outlive the arena of their allocator
+    **********************/
+
+    template <size_t Size>
+    class StackArena
+    {
+        alignas(std::max_align_t) std::byte buffer_[Size];
+        std::pmr::monotonic_buffer_resource resource_;
+
+    public:
+        explicit StackArena(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+            : resource_{buffer_, Size, upstream}
+        {
+        }
+
+        StackArena(const StackArena&) = delete;
+        StackArena& operator=(const StackArena&) = delete;
+
+        std::pmr::memory_resource* resource() noexcept { return &resource_; }
+
+        // all memory allocated from the arena is reclaimed - the buffer is reused from the beginning
+        void release() noexcept { resource_.release(); }
+    };
+
+    template <typename T>
+    class ArenaAllocator
+    {
+        std::pmr::memory_resource* resource_ = nullptr;
+
+        template <typename>
+        friend class ArenaAllocator;
+
+    public:
+        using value_type = T;
+
+        constexpr ArenaAllocator() noexcept = default;
+
+        constexpr ArenaAllocator(std::pmr::memory_resource* resource) noexcept
+            : resource_{resource}
+        {
+        }
+
+        template <size_t Size>
+        constexpr ArenaAllocator(StackArena<Size>& arena) noexcept
+            : resource_{arena.resource()}
+        {
+        }
+
+        template <typename U>
+        constexpr ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+            : resource_{other.resource_}
+        {
+        }
+
+        constexpr std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+        [[nodiscard]] constexpr T* allocate(size_t n)
+        {
+            if (std::is_constant_evaluated() || resource_ == nullptr)
+                return std::allocator<T>{}.allocate(n);
+
+            return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        constexpr void deallocate(T* ptr, size_t n) noexcept
+        {
+            if (std::is_constant_evaluated() || resource_ == nullptr)
+                std::allocator<T>{}.deallocate(ptr, n);
+            else
+                resource_->deallocate(ptr, n * sizeof(T), alignof(T));
+        }
+
+        template <typename U>
+        constexpr bool operator==(const ArenaAllocator<U>& other) const noexcept
+        {
+            return resource_ == other.resource_ || (resource_ != nullptr && other.resource_ != nullptr && resource_->is_equal(*other.resource_));
+        }
+    };
+} // namespace helpers
+
+#endif
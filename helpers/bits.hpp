@@ -0,0 +1,426 @@
+#ifndef BITS_HPP
+#define BITS_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace helpers::bits
+{
+    using Word = std::uint64_t;
+
+    constexpr size_t bits_per_word = std::numeric_limits<Word>::digits;
+
+    constexpr size_t words_for(size_t size)
+    {
+        return (size + bits_per_word - 1) / bits_per_word;
+    }
+
+    // mask of bits used in the last word
+    constexpr Word tail_mask(size_t size)
+    {
+        const size_t used_bits = size % bits_per_word;
+        return used_bits == 0 ? ~Word{} : (Word{1} << used_bits) - 1;
+    }
+
+    /*********************
+    DynamicBitset
+    - bits are stored in 64-bit words
+    - unused bits of the last word are always zero
+    - iterating yields bool values (read-only) - bits are modified with set()/reset()/flip()
+    **********************/
+    class DynamicBitset
+    {
+        std::vector<Word> words_;
+        size_t size_{};
+
+    public:
+        class const_iterator
+        {
+            const DynamicBitset* bitset_{};
+            std::ptrdiff_t index_{};
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = bool;
+            using difference_type = std::ptrdiff_t;
+            using reference = bool;
+            using pointer = void;
+
+            const_iterator() = default;
+
+            const_iterator(const DynamicBitset* bitset, std::ptrdiff_t index)
+                : bitset_{bitset}
+                , index_{index}
+            {
+            }
+
+            bool operator*() const { return bitset_->test(index_); }
+            bool operator[](difference_type n) const { return bitset_->test(index_ + n); }
+
+            const_iterator& operator++() { ++index_; return *this; }
+            const_iterator operator++(int) { auto tmp = *this; ++index_; return tmp; }
+            const_iterator& operator--() { --index_; return *this; }
+            const_iterator operator--(int) { auto tmp = *this; --index_; return tmp; }
+
+            const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+            const_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+            friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+            friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+            friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(const const_iterator& a, const const_iterator& b) { return a.index_ - b.index_; }
+
+            bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+            auto operator<=>(const const_iterator& other) const { return index_ <=> other.index_; }
+        };
+
+        using iterator = const_iterator;
+        using value_type = bool;
+
+        DynamicBitset() = default;
+
+        explicit DynamicBitset(size_t size, bool value = false)
+            : words_(words_for(size), value ? ~Word{} : Word{})
+            , size_{size}
+        {
+            clear_tail();
+        }
+
+        DynamicBitset(std::initializer_list<bool> bits)
+            : DynamicBitset(bits.size())
+        {
+            size_t index = 0;
+            for (bool bit : bits)
+                set(index++, bit);
+        }
+
+        size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        bool test(size_t index) const
+        {
+            assert(index < size_);
+            return (words_[index / bits_per_word] >> (index % bits_per_word)) & 1;
+        }
+
+        bool operator[](size_t index) const { return test(index); }
+
+        void set(size_t index, bool value = true)
+        {
+            assert(index < size_);
+            const Word mask = Word{1} << (index % bits_per_word);
+            Word& word = words_[index / bits_per_word];
+            word = value ? (word | mask) : (word & ~mask);
+        }
+
+        void reset(size_t index) { set(index, false); }
+
+        void flip(size_t index)
+        {
+            assert(index < size_);
+            words_[index / bits_per_word] ^= Word{1} << (index % bits_per_word);
+        }
+
+        std::span<Word> words() noexcept { return words_; }
+        std::span<const Word> words() const noexcept { return words_; }
+
+        // must be called after modifying words() directly
+        void clear_tail() noexcept
+        {
+            if (!words_.empty())
+                words_.back() &= tail_mask(size_);
+        }
+
+        const_iterator begin() const { return const_iterator{this, 0}; }
+        const_iterator end() const { return const_iterator{this, static_cast<std::ptrdiff_t>(size_)}; }
+
+        bool operator==(const DynamicBitset&) const = default;
+    };
+
+    static_assert(std::ranges::random_access_range<DynamicBitset>);
+    static_assert(std::ranges::sized_range<DynamicBitset>);
+
+    namespace Details
+    {
+        template <typename TWord>
+        struct WordBlocks
+        {
+            std::span<TWord> words;
+            size_t size; // in bits
+        };
+
+        inline WordBlocks<Word> words_of(DynamicBitset& bitset)
+        {
+            return {bitset.words(), bitset.size()};
+        }
+
+        inline WordBlocks<const Word> words_of(const DynamicBitset& bitset)
+        {
+            return {bitset.words(), bitset.size()};
+        }
+
+#if defined(__GLIBCXX__)
+        // libstdc++ exposes the word pointer of bit iterators; other implementations fall back to bitwise loops
+        template <typename TBitVector>
+            requires std::same_as<std::remove_const_t<TBitVector>, std::vector<bool>> && std::same_as<std::_Bit_type, Word>
+        auto words_of(TBitVector& vec)
+        {
+            using TWord = std::conditional_t<std::is_const_v<TBitVector>, const Word, Word>;
+            const size_t size = vec.size();
+            return WordBlocks<TWord>{std::span<TWord>{vec.begin()._M_p, words_for(size)}, size};
+        }
+#endif
+
+        template <typename Rng>
+        concept WordAddressable = requires(Rng& rng) { words_of(rng); };
+
+        template <typename Rng>
+        void assign_bit(Rng& rng, size_t index, bool value)
+        {
+            if constexpr (requires { rng.set(index, value); })
+                rng.set(index, value);
+            else
+                rng[index] = value;
+        }
+    } // namespace Details
+
+    template <typename Rng>
+    concept BitRange = std::same_as<std::remove_cvref_t<Rng>, DynamicBitset> || std::same_as<std::remove_cvref_t<Rng>, std::vector<bool>>;
+
+    ////////////////////////////////////////////////////////////////////////
+    // count
+
+    template <BitRange Rng>
+    size_t count(const Rng& rng, bool value = true)
+    {
+        size_t ones = 0;
+
+        if constexpr (Details::WordAddressable<const Rng>)
+        {
+            auto [words, size] = Details::words_of(rng);
+
+            if (words.empty())
+                return 0;
+
+            for (size_t i = 0; i + 1 < words.size(); ++i)
+                ones += std::popcount(words[i]);
+            ones += std::popcount(words.back() & tail_mask(size));
+        }
+        else
+            ones = std::ranges::count(rng, true);
+
+        return value ? ones : std::ranges::size(rng) - ones;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // find
+
+    template <BitRange Rng>
+    std::ranges::iterator_t<Rng&> find(Rng& rng, bool value)
+    {
+        if constexpr (Details::WordAddressable<Rng>)
+        {
+            auto [words, size] = Details::words_of(rng);
+
+            const Word inverter = value ? Word{} : ~Word{}; // searching for 0 is searching for 1 in ~word
+
+            for (size_t i = 0; i < words.size(); ++i)
+            {
+                Word word = words[i] ^ inverter;
+                if (i + 1 == words.size())
+                    word &= tail_mask(size);
+
+                if (word != 0)
+                    return std::ranges::next(std::ranges::begin(rng), i * bits_per_word + std::countr_zero(word));
+            }
+
+            return std::ranges::end(rng);
+        }
+        else
+            return std::ranges::find(rng, value);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // fill
+
+    template <BitRange Rng>
+    void fill(Rng& rng, bool value)
+    {
+        if constexpr (Details::WordAddressable<Rng>)
+        {
+            auto [words, size] = Details::words_of(rng);
+
+            std::ranges::fill(words, value ? ~Word{} : Word{});
+            if (!words.empty())
+                words.back() &= tail_mask(size);
+        }
+        else
+            std::ranges::fill(rng, value);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // transform - op is applied to whole words (std::bit_and<>, std::bit_or<>, std::bit_xor<>, std::bit_not<>)
+
+    template <BitRange InRng, BitRange OutRng, typename BitOp>
+        requires std::regular_invocable<BitOp&, Word>
+    void transform(const InRng& in, OutRng& out, BitOp op)
+    {
+        assert(std::ranges::size(in) == std::ranges::size(out));
+
+        if constexpr (Details::WordAddressable<const InRng> && Details::WordAddressable<OutRng>)
+        {
+            auto in_words = Details::words_of(in).words;
+            auto [out_words, size] = Details::words_of(out);
+
+            for (size_t i = 0; i < out_words.size(); ++i)
+                out_words[i] = static_cast<Word>(op(in_words[i]));
+
+            if (!out_words.empty())
+                out_words.back() &= tail_mask(size);
+        }
+        else
+        {
+            for (size_t i = 0; i < std::ranges::size(in); ++i)
+                Details::assign_bit(out, i, op(Word{in[i]}) & 1);
+        }
+    }
+
+    template <BitRange InRng1, BitRange InRng2, BitRange OutRng, typename BitOp>
+        requires std::regular_invocable<BitOp&, Word, Word>
+    void transform(const InRng1& in1, const InRng2& in2, OutRng& out, BitOp op)
+    {
+        assert(std::ranges::size(in1) == std::ranges::size(out));
+        assert(std::ranges::size(in2) == std::ranges::size(out));
+
+        if constexpr (Details::WordAddressable<const InRng1> && Details::WordAddressable<const InRng2> && Details::WordAddressable<OutRng>)
+        {
+            auto in1_words = Details::words_of(in1).words;
+            auto in2_words = Details::words_of(in2).words;
+            auto [out_words, size] = Details::words_of(out);
+
+            for (size_t i = 0; i < out_words.size(); ++i)
+                out_words[i] = static_cast<Word>(op(in1_words[i], in2_words[i]));
+
+            if (!out_words.empty())
+                out_words.back() &= tail_mask(size);
+        }
+        else
+        {
+            for (size_t i = 0; i < std::ranges::size(in1); ++i)
+                Details::assign_bit(out, i, op(Word{in1[i]}, Word{in2[i]}) & 1);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // set_bits - view of indexes of bits set to 1
+
+    class SetBitsView : public std::ranges::view_interface<SetBitsView>
+    {
+        std::span<const Word> words_;
+        size_t size_{};
+
+    public:
+        class iterator
+        {
+            std::span<const Word> words_;
+            size_t size_{};
+            size_t word_index_{};
+            Word current_{};
+
+            void skip_empty_words()
+            {
+                while (current_ == 0 && ++word_index_ < words_.size())
+                    current_ = load(word_index_);
+            }
+
+            Word load(size_t index) const
+            {
+                return index + 1 == words_.size() ? words_[index] & tail_mask(size_) : words_[index];
+            }
+
+        public:
+            using value_type = size_t;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            iterator(std::span<const Word> words, size_t size)
+                : words_{words}
+                , size_{size}
+            {
+                if (!words_.empty())
+                {
+                    current_ = load(0);
+                    skip_empty_words();
+                }
+            }
+
+            size_t operator*() const
+            {
+                return word_index_ * bits_per_word + std::countr_zero(current_);
+            }
+
+            iterator& operator++()
+            {
+                current_ &= current_ - 1; // clears the lowest set bit
+                skip_empty_words();
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(std::default_sentinel_t) const
+            {
+                return word_index_ >= words_.size();
+            }
+        };
+
+        SetBitsView() = default;
+
+        SetBitsView(std::span<const Word> words, size_t size)
+            : words_{words}
+            , size_{size}
+        {
+        }
+
+        iterator begin() const { return iterator{words_, size_}; }
+        std::default_sentinel_t end() const { return std::default_sentinel; }
+    };
+
+    template <BitRange Rng>
+    auto set_bits(const Rng& rng)
+    {
+        if constexpr (Details::WordAddressable<const Rng>)
+        {
+            auto [words, size] = Details::words_of(rng);
+            return SetBitsView{words, size};
+        }
+        else
+        {
+            return std::views::iota(size_t{0}, std::ranges::size(rng))
+                | std::views::filter([&rng](size_t index) { return static_cast<bool>(rng[index]); });
+        }
+    }
+
+    // the view refers to words of rng - a temporary would be destroyed before the view is used
+    template <BitRange Rng>
+    void set_bits(const Rng&&) = delete;
+} // namespace helpers::bits
+
+#endif
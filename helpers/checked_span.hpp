@@ -0,0 +1,405 @@
+#ifndef CHECKED_SPAN_HPP
+#define CHECKED_SPAN_HPP
+
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// checked spans are used in debug builds or when enabled explicitly (cmake -DENABLE_CHECKED_SPANS=ON)
+#ifndef HELPERS_CHECKED_SPANS
+#ifdef NDEBUG
+#define HELPERS_CHECKED_SPANS 0
+#else
+#define HELPERS_CHECKED_SPANS 1
+#endif
+#endif
+
+namespace helpers
+{
+    /*********************
+    CheckedVector<T> & CheckedSpan<T> - detection of spans invalidated by modifications of a vector
+    - checked build (HELPERS_CHECKED_SPANS == 1):
+      * vector keeps a generation counter - it is incremented when the buffer is reallocated, shrunk or destroyed
+      * span remembers the generation from its creation - access through a span from older generation
+        throws DanglingSpanError
+      * counter is allocated when the first span is taken
+    - release build: CheckedVector<T> is std::vector<T> & CheckedSpan<T> is std::span<T> - zero overhead
+    - checked versions are always available as checked::Vector<T> & checked::Span<T>
+    **********************/
+
+    class DanglingSpanError : public std::logic_error
+    {
+    public:
+        DanglingSpanError()
+            : std::logic_error{"CheckedSpan - access through a span invalidated by modification of its vector"}
+        {
+        }
+    };
+
+    namespace checked
+    {
+        using Generation = uint64_t;
+
+        template <typename T>
+        class Span
+        {
+            std::span<T> items_;
+            std::shared_ptr<const Generation> current_generation_;
+            Generation generation_{};
+
+            template <typename>
+            friend class Span;
+
+            void check() const
+            {
+                if (current_generation_ && *current_generation_ != generation_)
+                    throw DanglingSpanError{};
+            }
+
+        public:
+            using element_type = T;
+            using value_type = std::remove_cv_t<T>;
+            using iterator = typename std::span<T>::iterator;
+
+            Span() = default;
+
+            Span(std::span<T> items, std::shared_ptr<const Generation> current_generation) noexcept
+                : items_{items}
+                , current_generation_{std::move(current_generation)}
+                , generation_{current_generation_ ? *current_generation_ : Generation{}}
+            {
+            }
+
+            template <typename U>
+                requires std::is_convertible_v<U (*)[], T (*)[]>
+            Span(const Span<U>& other) noexcept
+                : items_{other.items_}
+                , current_generation_{other.current_generation_}
+                , generation_{other.generation_}
+            {
+            }
+
+            bool is_valid() const noexcept
+            {
+                return !current_generation_ || *current_generation_ == generation_;
+            }
+
+            size_t size() const noexcept { return items_.size(); }
+            bool empty() const noexcept { return items_.empty(); }
+
+            T& operator[](size_t index) const
+            {
+                check();
+                assert(index < items_.size());
+                return items_[index];
+            }
+
+            T& front() const { return (*this)[0]; }
+            T& back() const { return (*this)[size() - 1]; }
+
+            T* data() const
+            {
+                check();
+                return items_.data();
+            }
+
+            // iterators are not checked - validity is checked once when iteration starts
+            iterator begin() const
+            {
+                check();
+                return items_.begin();
+            }
+
+            iterator end() const
+            {
+                check();
+                return items_.end();
+            }
+
+            Span subspan(size_t offset, size_t count = std::dynamic_extent) const
+            {
+                check();
+                return Span{items_.subspan(offset, count), current_generation_, generation_};
+            }
+
+            Span first(size_t count) const { return subspan(0, count); }
+            Span last(size_t count) const { return subspan(size() - count, count); }
+
+            // std::span of a valid span - for APIs taking std::span
+            operator std::span<T>() const
+            {
+                check();
+                return items_;
+            }
+
+            template <typename U>
+                requires std::is_convertible_v<T (*)[], U (*)[]> && (!std::same_as<T, U>)
+            operator std::span<U>() const
+            {
+                check();
+                return items_;
+            }
+
+        private:
+            Span(std::span<T> items, std::shared_ptr<const Generation> current_generation, Generation generation) noexcept
+                : items_{items}
+                , current_generation_{std::move(current_generation)}
+                , generation_{generation}
+            {
+            }
+        };
+
+        template <typename T>
+        class Vector
+        {
+            std::vector<T> items_;
+            mutable std::shared_ptr<Generation> generation_; // created when the first span is taken - not a part of the value
+
+            void invalidate() noexcept
+            {
+                if (generation_)
+                    ++*generation_;
+            }
+
+            // spans are invalidated if the buffer was reallocated or items were removed
+            template <typename F>
+            decltype(auto) modify(F&& f)
+            {
+                const T* data = items_.data();
+                const size_t size = items_.size();
+
+                struct Guard // also if f throws
+                {
+                    Vector& vec;
+                    const T* data;
+                    size_t size;
+
+                    ~Guard()
+                    {
+                        if (vec.items_.data() != data || vec.items_.size() < size)
+                            vec.invalidate();
+                    }
+                } guard{*this, data, size};
+
+                return f(items_);
+            }
+
+        public:
+            using value_type = T;
+            using size_type = size_t;
+            using iterator = typename std::vector<T>::iterator;
+            using const_iterator = typename std::vector<T>::const_iterator;
+
+            Vector() = default;
+
+            explicit Vector(size_t size, const T& value = T{})
+                : items_(size, value)
+            {
+            }
+
+            Vector(std::initializer_list<T> items)
+                : items_(items)
+            {
+            }
+
+            template <std::input_iterator It>
+            Vector(It first, It last)
+                : items_(first, last)
+            {
+            }
+
+            Vector(const Vector& other)
+                : items_{other.items_}
+            {
+            }
+
+            Vector& operator=(const Vector& other)
+            {
+                if (this != &other)
+                    modify([&](std::vector<T>& items) { items = other.items_; });
+                return *this;
+            }
+
+            // spans follow the moved buffer
+            Vector(Vector&& other) noexcept
+                : items_{std::move(other.items_)}
+                , generation_{std::move(other.generation_)}
+            {
+            }
+
+            Vector& operator=(Vector&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    invalidate();
+                    items_ = std::move(other.items_);
+                    generation_ = std::move(other.generation_);
+                }
+                return *this;
+            }
+
+            ~Vector()
+            {
+                invalidate();
+            }
+
+            void swap(Vector& other) noexcept
+            {
+                items_.swap(other.items_);
+                generation_.swap(other.generation_);
+            }
+
+            size_t size() const noexcept { return items_.size(); }
+            size_t capacity() const noexcept { return items_.capacity(); }
+            bool empty() const noexcept { return items_.empty(); }
+
+            T* data() noexcept { return items_.data(); }
+            const T* data() const noexcept { return items_.data(); }
+
+            T& operator[](size_t index) { return items_[index]; }
+            const T& operator[](size_t index) const { return items_[index]; }
+            T& at(size_t index) { return items_.at(index); }
+            const T& at(size_t index) const { return items_.at(index); }
+            T& front() { return items_.front(); }
+            const T& front() const { return items_.front(); }
+            T& back() { return items_.back(); }
+            const T& back() const { return items_.back(); }
+
+            iterator begin() noexcept { return items_.begin(); }
+            iterator end() noexcept { return items_.end(); }
+            const_iterator begin() const noexcept { return items_.begin(); }
+            const_iterator end() const noexcept { return items_.end(); }
+
+            void push_back(const T& value)
+            {
+                modify([&](std::vector<T>& items) { items.push_back(value); });
+            }
+
+            void push_back(T&& value)
+            {
+                modify([&](std::vector<T>& items) { items.push_back(std::move(value)); });
+            }
+
+            template <typename... TArgs>
+            T& emplace_back(TArgs&&... args)
+            {
+                return modify([&](std::vector<T>& items) -> T& { return items.emplace_back(std::forward<TArgs>(args)...); });
+            }
+
+            void pop_back()
+            {
+                modify([](std::vector<T>& items) { items.pop_back(); });
+            }
+
+            iterator insert(const_iterator pos, const T& value)
+            {
+                invalidate(); // items after pos are moved
+                return items_.insert(pos, value);
+            }
+
+            iterator erase(const_iterator pos)
+            {
+                invalidate();
+                return items_.erase(pos);
+            }
+
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                invalidate();
+                return items_.erase(first, last);
+            }
+
+            void resize(size_t size)
+            {
+                modify([&](std::vector<T>& items) { items.resize(size); });
+            }
+
+            void reserve(size_t capacity)
+            {
+                modify([&](std::vector<T>& items) { items.reserve(capacity); });
+            }
+
+            void shrink_to_fit()
+            {
+                modify([](std::vector<T>& items) { items.shrink_to_fit(); });
+            }
+
+            void clear() noexcept
+            {
+                modify([](std::vector<T>& items) { items.clear(); });
+            }
+
+            Span<T> span()
+            {
+                return Span<T>{std::span<T>{items_}, current_generation()};
+            }
+
+            Span<const T> span() const
+            {
+                return Span<const T>{std::span<const T>{items_}, current_generation()};
+            }
+
+        private:
+            const std::shared_ptr<Generation>& current_generation() const
+            {
+                if (!generation_)
+                    generation_ = std::make_shared<Generation>(0);
+                return generation_;
+            }
+
+        public:
+
+            bool operator==(const Vector& other) const { return items_ == other.items_; }
+            auto operator<=>(const Vector& other) const { return items_ <=> other.items_; }
+        };
+    } // namespace checked
+
+#if HELPERS_CHECKED_SPANS
+    template <typename T>
+    using CheckedVector = checked::Vector<T>;
+
+    template <typename T>
+    using CheckedSpan = checked::Span<T>;
+
+    template <typename T>
+    CheckedSpan<T> checked_span(CheckedVector<T>& vec)
+    {
+        return vec.span();
+    }
+
+    template <typename T>
+    CheckedSpan<const T> checked_span(const CheckedVector<T>& vec)
+    {
+        return vec.span();
+    }
+#else
+    template <typename T>
+    using CheckedVector = std::vector<T>;
+
+    template <typename T>
+    using CheckedSpan = std::span<T>;
+
+    template <typename T>
+    CheckedSpan<T> checked_span(CheckedVector<T>& vec) noexcept
+    {
+        return std::span<T>{vec};
+    }
+
+    template <typename T>
+    CheckedSpan<const T> checked_span(const CheckedVector<T>& vec) noexcept
+    {
+        return std::span<const T>{vec};
+    }
+#endif
+} // namespace helpers
+
+#endif
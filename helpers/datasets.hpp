@@ -0,0 +1,83 @@
+#ifndef DATASETS_HPP
+#define DATASETS_HPP
+
+#include "random.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// datasets generated at compile time & stored in .rodata (cmake -DBAKE_DATASETS=ON)
+#ifndef HELPERS_BAKE_DATASETS
+#define HELPERS_BAKE_DATASETS 0
+#endif
+
+namespace helpers
+{
+    /*********************
+    Numeric datasets for tests & benchmarks
+    - values are generated with PCG both at compile time and at runtime - the same parameters give the same data
+    - fill_numeric_dataset() writes directly into the destination (std::array, constinit storage, vector)
+      in chunks - loops stay below iteration limits of constant evaluation (GCC: 262144 iterations per loop)
+    - numeric_dataset<Size, Params>() - dataset in static storage:
+      * HELPERS_BAKE_DATASETS == 1 - generated by the compiler & embedded in the binary (no startup cost,
+        longer compilation & larger binary; limits of constant evaluation are raised by the BAKE_DATASETS cmake option)
+      * otherwise - generated on first use
+    **********************/
+
+    struct DatasetParams
+    {
+        uint32_t seed = 42;
+        int low = -100;  // inclusive
+        int high = 100; // exclusive
+    };
+
+    // values of items [offset, offset + data.size()) of the dataset
+    constexpr void fill_numeric_dataset(std::span<int> data, DatasetParams params = {}, size_t offset = 0)
+    {
+        constexpr size_t chunk_size = 1 << 16;
+
+        random::PCG rnd_gen{params.seed};
+        rnd_gen.advance(offset);
+
+        const uint32_t width = static_cast<uint32_t>(params.high - params.low);
+
+        for (size_t chunk = 0; chunk < data.size(); chunk += chunk_size)
+        {
+            const size_t chunk_end = std::min(chunk + chunk_size, data.size());
+            for (size_t i = chunk; i < chunk_end; ++i)
+                data[i] = static_cast<int>(rnd_gen() % width + static_cast<uint32_t>(params.low));
+        }
+    }
+
+    template <size_t Size>
+    [[nodiscard]] constexpr std::array<int, Size> make_numeric_dataset(DatasetParams params = {})
+    {
+        std::array<int, Size> data{};
+        fill_numeric_dataset(data, params);
+        return data;
+    }
+
+    template <size_t Size, DatasetParams Params = DatasetParams{}>
+    inline constexpr std::array<int, Size> baked_numeric_dataset = make_numeric_dataset<Size>(Params);
+
+    template <size_t Size, DatasetParams Params = DatasetParams{}>
+    std::span<const int, Size> numeric_dataset()
+    {
+#if HELPERS_BAKE_DATASETS
+        return baked_numeric_dataset<Size, Params>;
+#else
+        static const std::array<int, Size>& data = []() -> const std::array<int, Size>& {
+            static std::array<int, Size> storage; // static storage - too large for the stack
+            fill_numeric_dataset(storage, Params);
+            return storage;
+        }();
+
+        return data;
+#endif
+    }
+} // namespace helpers
+
+#endif
@@ -0,0 +1,772 @@
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HELPERS_FLAT_MAP_SSE2
+#endif
+
+namespace helpers
+{
+    // hash for FlatHashMap - strings are hashed as std::string_view, so lookups with const char* & std::string_view do not create temporaries
+    template <typename Key>
+    struct FlatHash : std::hash<Key>
+    {
+    };
+
+    template <>
+    struct FlatHash<std::string>
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view key) const noexcept
+        {
+            return std::hash<std::string_view>{}(key);
+        }
+    };
+
+    namespace Details
+    {
+        template <typename Hash, typename KeyEqual>
+        concept TransparentLookup = requires {
+            typename Hash::is_transparent;
+            typename KeyEqual::is_transparent;
+        };
+
+        // identity hashes (std::hash<int>) are mixed so that low & high bits are both usable
+        constexpr size_t mix_hash(size_t hash) noexcept
+        {
+            hash *= 0x9E3779B97F4A7C15ULL;
+            return hash ^ (hash >> 32);
+        }
+
+        /*********************
+        Control bytes of a group of 16 slots:
+        - empty = -128, deleted = -2 (sign bit set)
+        - full = 7 lowest bits of the hash (0..127)
+        **********************/
+        struct ControlGroup
+        {
+            static constexpr size_t width = 16;
+            static constexpr int8_t empty = -128;
+            static constexpr int8_t deleted = -2;
+
+            // bit i is set if ctrl[i] == value
+            static uint32_t match(const int8_t* ctrl, int8_t value) noexcept
+            {
+#ifdef HELPERS_FLAT_MAP_SSE2
+                const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), group)));
+#else
+                uint32_t mask = 0;
+                for (size_t i = 0; i < width; ++i)
+                    mask |= static_cast<uint32_t>(ctrl[i] == value) << i;
+                return mask;
+#endif
+            }
+
+            static uint32_t match_empty_or_deleted(const int8_t* ctrl) noexcept
+            {
+#ifdef HELPERS_FLAT_MAP_SSE2
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))));
+#else
+                uint32_t mask = 0;
+                for (size_t i = 0; i < width; ++i)
+                    mask |= static_cast<uint32_t>(ctrl[i] < 0) << i;
+                return mask;
+#endif
+            }
+        };
+    } // namespace Details
+
+    /*********************
+    FlatHashMap - open addressing hash map (Swiss table layout)
+    - slots & control bytes are stored in two flat arrays
+    - a lookup compares 16 control bytes at once (SSE2) and touches keys only for matching 7-bit hashes
+    - value_type is std::pair<Key, Value> - keys must not be modified through iterators
+    - rehashing invalidates iterators & references
+    **********************/
+    template <typename Key, typename Value, typename Hash = FlatHash<Key>, typename KeyEqual = std::equal_to<>,
+        typename Allocator = std::allocator<std::pair<Key, Value>>>
+    class FlatHashMap
+    {
+        using Group = Details::ControlGroup;
+        using AllocTraits = std::allocator_traits<Allocator>;
+        using CtrlAllocator = typename AllocTraits::template rebind_alloc<int8_t>;
+
+        static constexpr size_t npos = static_cast<size_t>(-1);
+        static constexpr bool is_transparent = Details::TransparentLookup<Hash, KeyEqual>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<Key, Value>;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
+
+        template <bool IsConst>
+        class Iterator
+        {
+            friend class FlatHashMap;
+
+            using TSlot = std::conditional_t<IsConst, const std::pair<Key, Value>, std::pair<Key, Value>>;
+
+            const int8_t* ctrl_{};
+            const int8_t* ctrl_end_{};
+            TSlot* slot_{};
+
+            Iterator(const int8_t* ctrl, const int8_t* ctrl_end, TSlot* slot)
+                : ctrl_{ctrl}
+                , ctrl_end_{ctrl_end}
+                , slot_{slot}
+            {
+                skip_free_slots();
+            }
+
+            void skip_free_slots()
+            {
+                while (ctrl_ != ctrl_end_ && *ctrl_ < 0)
+                {
+                    ++ctrl_;
+                    ++slot_;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::pair<Key, Value>;
+            using difference_type = std::ptrdiff_t;
+            using reference = TSlot&;
+            using pointer = TSlot*;
+
+            Iterator() = default;
+
+            template <bool OtherIsConst>
+                requires (IsConst && !OtherIsConst)
+            Iterator(const Iterator<OtherIsConst>& other)
+                : ctrl_{other.ctrl_}
+                , ctrl_end_{other.ctrl_end_}
+                , slot_{other.slot_}
+            {
+            }
+
+            reference operator*() const { return *slot_; }
+            pointer operator->() const { return slot_; }
+
+            Iterator& operator++()
+            {
+                ++ctrl_;
+                ++slot_;
+                skip_free_slots();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const { return slot_ == other.slot_; }
+
+            friend class Iterator<!IsConst>;
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        FlatHashMap() = default;
+
+        explicit FlatHashMap(size_t item_count, const Allocator& allocator = Allocator{})
+            : allocator_{allocator}
+        {
+            reserve(item_count);
+        }
+
+        FlatHashMap(std::initializer_list<value_type> items)
+        {
+            reserve(items.size());
+            for (const auto& [key, value] : items)
+                try_emplace(key, value);
+        }
+
+        FlatHashMap(const FlatHashMap& other)
+            : hash_{other.hash_}
+            , key_equal_{other.key_equal_}
+            , allocator_{AllocTraits::select_on_container_copy_construction(other.allocator_)}
+        {
+            reserve(other.size());
+            for (const auto& [key, value] : other)
+                try_emplace(key, value);
+        }
+
+        FlatHashMap(FlatHashMap&& other) noexcept
+            : hash_{std::move(other.hash_)}
+            , key_equal_{std::move(other.key_equal_)}
+            , allocator_{std::move(other.allocator_)}
+        {
+            swap_storage(other);
+        }
+
+        FlatHashMap& operator=(FlatHashMap other) noexcept
+        {
+            std::swap(hash_, other.hash_);
+            std::swap(key_equal_, other.key_equal_);
+            std::swap(allocator_, other.allocator_);
+            swap_storage(other);
+            return *this;
+        }
+
+        ~FlatHashMap()
+        {
+            destroy_storage();
+        }
+
+        size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        size_t bucket_count() const noexcept { return capacity_; }
+
+        iterator begin() noexcept { return iterator{ctrl_, ctrl_ + capacity_, slots_}; }
+        iterator end() noexcept { return iterator{ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_}; }
+        const_iterator begin() const noexcept { return const_iterator{ctrl_, ctrl_ + capacity_, slots_}; }
+        const_iterator end() const noexcept { return const_iterator{ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_}; }
+
+        void clear() noexcept
+        {
+            for (size_t i = 0; i < capacity_; ++i)
+            {
+                if (ctrl_[i] >= 0)
+                    AllocTraits::destroy(allocator_, slots_ + i);
+                ctrl_[i] = Group::empty;
+            }
+            size_ = 0;
+            tombstones_ = 0;
+        }
+
+        // prepares space for item_count items without rehashing
+        void reserve(size_t item_count)
+        {
+            size_t new_capacity = Group::width;
+            while (max_load(new_capacity) < item_count)
+                new_capacity *= 2;
+
+            if (new_capacity > capacity_)
+                rehash(new_capacity);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // lookup
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        iterator find(const K& key)
+        {
+            const size_t index = find_index(key);
+            return index == npos ? end() : iterator_at(index);
+        }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        const_iterator find(const K& key) const
+        {
+            const size_t index = find_index(key);
+            return index == npos ? end() : const_iterator_at(index);
+        }
+
+        iterator find(const Key& key) { return find<Key>(key); }
+        const_iterator find(const Key& key) const { return find<Key>(key); }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        bool contains(const K& key) const
+        {
+            return find_index(key) != npos;
+        }
+
+        bool contains(const Key& key) const { return contains<Key>(key); }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        Value& at(const K& key)
+        {
+            const size_t index = find_index(key);
+            if (index == npos)
+                throw std::out_of_range("FlatHashMap::at - key not found");
+            return slots_[index].second;
+        }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        const Value& at(const K& key) const
+        {
+            const size_t index = find_index(key);
+            if (index == npos)
+                throw std::out_of_range("FlatHashMap::at - key not found");
+            return slots_[index].second;
+        }
+
+        Value& at(const Key& key) { return at<Key>(key); }
+        const Value& at(const Key& key) const { return at<Key>(key); }
+
+        ////////////////////////////////////////////////////////////////////////
+        // modifiers
+
+        // the key is constructed only when a new item is inserted
+        template <typename K, typename... TArgs>
+            requires (is_transparent || std::same_as<std::remove_cvref_t<K>, Key>) && std::constructible_from<Key, K&&>
+        std::pair<iterator, bool> try_emplace(K&& key, TArgs&&... args)
+        {
+            const size_t hash = hash_of(key);
+
+            if (const size_t index = find_index(key, hash); index != npos)
+                return {iterator_at(index), false};
+
+            if (size_ + tombstones_ + 1 > max_load(capacity_))
+                rehash(size_ + 1 > max_load(capacity_) / 2 ? std::max(capacity_ * 2, Group::width) : capacity_); // grow or purge tombstones
+
+            const size_t index = find_insert_index(hash);
+            if (ctrl_[index] == Group::deleted)
+                --tombstones_;
+
+            AllocTraits::construct(allocator_, slots_ + index, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<TArgs>(args)...));
+            ctrl_[index] = h2(hash);
+            ++size_;
+
+            return {iterator_at(index), true};
+        }
+
+        std::pair<iterator, bool> insert(value_type item)
+        {
+            return try_emplace(std::move(item.first), std::move(item.second));
+        }
+
+        template <typename K>
+            requires (is_transparent || std::same_as<std::remove_cvref_t<K>, Key>) && std::constructible_from<Key, K&&>
+        Value& operator[](K&& key)
+        {
+            return try_emplace(std::forward<K>(key)).first->second;
+        }
+
+        Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+        Value& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        size_t erase(const K& key)
+        {
+            const size_t index = find_index(key);
+            if (index == npos)
+                return 0;
+
+            AllocTraits::destroy(allocator_, slots_ + index);
+            --size_;
+
+            // a group with an empty slot ends every probe sequence - no tombstone is needed there
+            const int8_t* group_ctrl = ctrl_ + (index / Group::width) * Group::width;
+            if (Group::match(group_ctrl, Group::empty) != 0)
+                ctrl_[index] = Group::empty;
+            else
+            {
+                ctrl_[index] = Group::deleted;
+                ++tombstones_;
+            }
+
+            return 1;
+        }
+
+        size_t erase(const Key& key) { return erase<Key>(key); }
+
+    private:
+        int8_t* ctrl_{};
+        value_type* slots_{};
+        size_t capacity_{};
+        size_t size_{};
+        size_t tombstones_{};
+        [[no_unique_address]] Hash hash_{};
+        [[no_unique_address]] KeyEqual key_equal_{};
+        [[no_unique_address]] Allocator allocator_{};
+
+        static constexpr size_t max_load(size_t capacity) noexcept
+        {
+            return capacity - capacity / 8; // load factor 7/8
+        }
+
+        static int8_t h2(size_t hash) noexcept
+        {
+            return static_cast<int8_t>(hash & 0x7F);
+        }
+
+        template <typename K>
+        size_t hash_of(const K& key) const
+        {
+            return Details::mix_hash(hash_(key));
+        }
+
+        iterator iterator_at(size_t index) noexcept
+        {
+            return iterator{ctrl_ + index, ctrl_ + capacity_, slots_ + index};
+        }
+
+        const_iterator const_iterator_at(size_t index) const noexcept
+        {
+            return const_iterator{ctrl_ + index, ctrl_ + capacity_, slots_ + index};
+        }
+
+        template <typename K>
+        size_t find_index(const K& key) const
+        {
+            return find_index(key, hash_of(key));
+        }
+
+        // triangular probing over groups visits every group when their count is a power of 2
+        template <typename K>
+        size_t find_index(const K& key, size_t hash) const
+        {
+            if (size_ == 0)
+                return npos;
+
+            const size_t group_mask = capacity_ / Group::width - 1;
+            size_t group = (hash >> 7) & group_mask;
+
+            for (size_t step = 1;; ++step)
+            {
+                const int8_t* group_ctrl = ctrl_ + group * Group::width;
+
+                for (uint32_t matches = Group::match(group_ctrl, h2(hash)); matches != 0; matches &= matches - 1)
+                {
+                    const size_t index = group * Group::width + std::countr_zero(matches);
+                    if (key_equal_(slots_[index].first, key))
+                        return index;
+                }
+
+                if (Group::match(group_ctrl, Group::empty) != 0)
+                    return npos;
+
+                group = (group + step) & group_mask;
+            }
+        }
+
+        static size_t find_insert_index(const int8_t* ctrl, size_t capacity, size_t hash) noexcept
+        {
+            const size_t group_mask = capacity / Group::width - 1;
+            size_t group = (hash >> 7) & group_mask;
+
+            for (size_t step = 1;; ++step)
+            {
+                if (uint32_t free_slots = Group::match_empty_or_deleted(ctrl + group * Group::width); free_slots != 0)
+                    return group * Group::width + std::countr_zero(free_slots);
+
+                group = (group + step) & group_mask;
+            }
+        }
+
+        size_t find_insert_index(size_t hash) const noexcept
+        {
+            return find_insert_index(ctrl_, capacity_, hash);
+        }
+
+        // items are moved only if neither the move nor hashing can throw - otherwise they are copied,
+        // so the old table is left intact when the migration fails
+        static constexpr bool nothrow_migration = std::is_nothrow_move_constructible_v<value_type>
+            && std::is_nothrow_invocable_v<const Hash&, const Key&>;
+
+        static decltype(auto) migrated(value_type& item) noexcept
+        {
+            if constexpr (nothrow_migration || !std::is_copy_constructible_v<value_type>)
+                return std::move(item);
+            else
+                return std::as_const(item);
+        }
+
+        void destroy_items(const int8_t* ctrl, value_type* slots, size_t capacity) noexcept
+        {
+            for (size_t i = 0; i < capacity; ++i)
+                if (ctrl[i] >= 0)
+                    AllocTraits::destroy(allocator_, slots + i);
+        }
+
+        void deallocate(int8_t* ctrl, value_type* slots, size_t capacity) noexcept
+        {
+            if (capacity == 0)
+                return;
+
+            CtrlAllocator ctrl_allocator{allocator_};
+            std::allocator_traits<CtrlAllocator>::deallocate(ctrl_allocator, ctrl, capacity);
+            AllocTraits::deallocate(allocator_, slots, capacity);
+        }
+
+        // strong guarantee - the new table replaces the old one only after all items are migrated
+        void rehash(size_t new_capacity)
+        {
+            CtrlAllocator ctrl_allocator{allocator_};
+
+            int8_t* new_ctrl = std::allocator_traits<CtrlAllocator>::allocate(ctrl_allocator, new_capacity);
+            value_type* new_slots{};
+            try
+            {
+                new_slots = AllocTraits::allocate(allocator_, new_capacity);
+            }
+            catch (...)
+            {
+                std::allocator_traits<CtrlAllocator>::deallocate(ctrl_allocator, new_ctrl, new_capacity);
+                throw;
+            }
+
+            std::fill_n(new_ctrl, new_capacity, Group::empty);
+
+            try
+            {
+                for (size_t i = 0; i < capacity_; ++i)
+                {
+                    if (ctrl_[i] < 0)
+                        continue;
+
+                    const size_t hash = hash_of(slots_[i].first);
+                    const size_t index = find_insert_index(new_ctrl, new_capacity, hash);
+                    AllocTraits::construct(allocator_, new_slots + index, migrated(slots_[i]));
+                    new_ctrl[index] = h2(hash);
+                }
+            }
+            catch (...)
+            {
+                destroy_items(new_ctrl, new_slots, new_capacity);
+                deallocate(new_ctrl, new_slots, new_capacity);
+                throw;
+            }
+
+            destroy_items(ctrl_, slots_, capacity_);
+            deallocate(ctrl_, slots_, capacity_);
+
+            ctrl_ = new_ctrl;
+            slots_ = new_slots;
+            capacity_ = new_capacity;
+            tombstones_ = 0;
+        }
+
+        void destroy_storage() noexcept
+        {
+            destroy_items(ctrl_, slots_, capacity_);
+            deallocate(ctrl_, slots_, capacity_);
+        }
+
+        void swap_storage(FlatHashMap& other) noexcept
+        {
+            std::swap(ctrl_, other.ctrl_);
+            std::swap(slots_, other.slots_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(size_, other.size_);
+            std::swap(tombstones_, other.tombstones_);
+        }
+    };
+
+    /*********************
+    FlatSortedMap - items sorted by key in a contiguous vector
+    - lookup is a binary search, iteration is ordered & cache friendly
+    - inserting/erasing a single item is O(n) - build from a range for bulk loads
+    - with transparent Compare (std::less<>) lookups by const char* & std::string_view do not create temporaries
+    **********************/
+    template <typename Key, typename Value, typename Compare = std::less<>, typename Allocator = std::allocator<std::pair<Key, Value>>>
+    class FlatSortedMap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<Key, Value>;
+        using size_type = size_t;
+        using key_compare = Compare;
+        using allocator_type = Allocator;
+
+    private:
+        using Storage = std::vector<value_type, Allocator>;
+
+        static constexpr bool is_transparent = requires { typename Compare::is_transparent; };
+
+        Storage items_;
+        [[no_unique_address]] Compare compare_{};
+
+    public:
+        using iterator = typename Storage::iterator;
+        using const_iterator = typename Storage::const_iterator;
+
+        FlatSortedMap() = default;
+
+        explicit FlatSortedMap(const Allocator& allocator)
+            : items_(allocator)
+        {
+        }
+
+        // bulk load - one sort instead of n inserts; for duplicated keys the first item is kept
+        template <std::ranges::input_range Rng>
+            requires std::convertible_to<std::ranges::range_reference_t<Rng>, value_type>
+            && (!std::same_as<std::remove_cvref_t<Rng>, FlatSortedMap>) // copy of a non-const lvalue is not a bulk load
+        explicit FlatSortedMap(Rng&& items, const Allocator& allocator = Allocator{})
+            : items_(allocator)
+        {
+            std::ranges::copy(items, std::back_inserter(items_));
+            sort_unique();
+        }
+
+        FlatSortedMap(std::initializer_list<value_type> items)
+            : items_(items)
+        {
+            sort_unique();
+        }
+
+        size_t size() const noexcept { return items_.size(); }
+        bool empty() const noexcept { return items_.empty(); }
+        size_t capacity() const noexcept { return items_.capacity(); }
+        void reserve(size_t item_count) { items_.reserve(item_count); }
+        void clear() noexcept { items_.clear(); }
+
+        iterator begin() noexcept { return items_.begin(); }
+        iterator end() noexcept { return items_.end(); }
+        const_iterator begin() const noexcept { return items_.begin(); }
+        const_iterator end() const noexcept { return items_.end(); }
+
+        ////////////////////////////////////////////////////////////////////////
+        // lookup
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        iterator lower_bound(const K& key)
+        {
+            return std::lower_bound(items_.begin(), items_.end(), key, key_less());
+        }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        const_iterator lower_bound(const K& key) const
+        {
+            return std::lower_bound(items_.begin(), items_.end(), key, key_less());
+        }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        iterator find(const K& key)
+        {
+            auto pos = lower_bound(key);
+            return (pos != items_.end() && !compare_(key, pos->first)) ? pos : items_.end();
+        }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        const_iterator find(const K& key) const
+        {
+            auto pos = lower_bound(key);
+            return (pos != items_.end() && !compare_(key, pos->first)) ? pos : items_.end();
+        }
+
+        iterator find(const Key& key) { return find<Key>(key); }
+        const_iterator find(const Key& key) const { return find<Key>(key); }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        bool contains(const K& key) const
+        {
+            return find(key) != items_.end();
+        }
+
+        bool contains(const Key& key) const { return contains<Key>(key); }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        const Value& at(const K& key) const
+        {
+            auto pos = find(key);
+            if (pos == items_.end())
+                throw std::out_of_range("FlatSortedMap::at - key not found");
+            return pos->second;
+        }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        Value& at(const K& key)
+        {
+            return const_cast<Value&>(std::as_const(*this).at(key));
+        }
+
+        const Value& at(const Key& key) const { return at<Key>(key); }
+        Value& at(const Key& key) { return at<Key>(key); }
+
+        ////////////////////////////////////////////////////////////////////////
+        // modifiers
+
+        template <typename K, typename... TArgs>
+            requires (is_transparent || std::same_as<std::remove_cvref_t<K>, Key>) && std::constructible_from<Key, K&&>
+        std::pair<iterator, bool> try_emplace(K&& key, TArgs&&... args)
+        {
+            auto pos = lower_bound(key);
+            if (pos != items_.end() && !compare_(key, pos->first))
+                return {pos, false};
+
+            pos = items_.emplace(pos, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<TArgs>(args)...));
+            return {pos, true};
+        }
+
+        std::pair<iterator, bool> insert(value_type item)
+        {
+            return try_emplace(std::move(item.first), std::move(item.second));
+        }
+
+        template <typename K>
+            requires (is_transparent || std::same_as<std::remove_cvref_t<K>, Key>) && std::constructible_from<Key, K&&>
+        Value& operator[](K&& key)
+        {
+            return try_emplace(std::forward<K>(key)).first->second;
+        }
+
+        Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+        Value& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+        template <typename K>
+            requires is_transparent || std::same_as<K, Key>
+        size_t erase(const K& key)
+        {
+            auto pos = find(key);
+            if (pos == items_.end())
+                return 0;
+
+            items_.erase(pos);
+            return 1;
+        }
+
+        size_t erase(const Key& key) { return erase<Key>(key); }
+
+    private:
+        auto key_less() const
+        {
+            return [this](const value_type& item, const auto& key) { return compare_(item.first, key); };
+        }
+
+        void sort_unique()
+        {
+            std::ranges::stable_sort(items_, compare_, &value_type::first);
+            auto duplicates = std::ranges::unique(items_, [this](const Key& a, const Key& b) { return !compare_(a, b); }, &value_type::first);
+            items_.erase(duplicates.begin(), duplicates.end());
+        }
+    };
+} // namespace helpers
+
+#endif
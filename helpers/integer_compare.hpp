@@ -0,0 +1,364 @@
+#ifndef INTEGER_COMPARE_HPP
+#define INTEGER_COMPARE_HPP
+
+#include "bits.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HELPERS_INTEGER_COMPARE_SSE2
+#endif
+
+namespace helpers
+{
+    /*********************
+    Column kernels of std::cmp_less, std::cmp_equal & std::in_range
+    - operands are columns (contiguous ranges of integers) or single values - at least one operand is a column
+    - results are bitmasks (bits::DynamicBitset) - bit i is the result for row i
+    - semantics are the same as of std::cmp_* for every signed/unsigned width pair:
+      values are compared as mathematical integers (-1 < 0u)
+    - rows are compared without branches in blocks of 64 - the comparison loop vectorizes
+      and 64 results are packed into one word (SSE2 movemask)
+    - select() converts a bitmask into a selection vector (indexes of matching rows)
+    - narrow_into() converts a column to a narrower integer type - whole blocks are validated before copying
+    **********************/
+
+    template <typename T>
+    concept StandardInteger = std::integral<T>
+        && !std::same_as<std::remove_cv_t<T>, bool> && !std::same_as<std::remove_cv_t<T>, char>
+        && !std::same_as<std::remove_cv_t<T>, wchar_t> && !std::same_as<std::remove_cv_t<T>, char8_t>
+        && !std::same_as<std::remove_cv_t<T>, char16_t> && !std::same_as<std::remove_cv_t<T>, char32_t>;
+
+    template <typename Rng>
+    concept IntegerColumn = std::ranges::contiguous_range<Rng> && std::ranges::sized_range<Rng>
+        && StandardInteger<std::ranges::range_value_t<Rng>>;
+
+    template <typename T>
+    concept ColumnOperand = IntegerColumn<T> || StandardInteger<T>;
+
+    namespace Details
+    {
+        // branch-free versions of std::cmp_less & std::cmp_equal - mixed signs are resolved in the wider type if possible
+        template <StandardInteger T, StandardInteger U>
+        constexpr bool less(T a, U b) noexcept
+        {
+            if constexpr (std::is_signed_v<T> == std::is_signed_v<U>)
+                return a < b;
+            else if constexpr (std::is_signed_v<T>)
+            {
+                if constexpr (sizeof(U) < sizeof(T)) // b fits in T
+                    return a < static_cast<T>(b);
+                else
+                    return (a < 0) | (static_cast<std::make_unsigned_t<T>>(a) < b);
+            }
+            else
+            {
+                if constexpr (sizeof(T) < sizeof(U)) // a fits in U
+                    return static_cast<U>(a) < b;
+                else
+                    return (b >= 0) & (a < static_cast<std::make_unsigned_t<U>>(b));
+            }
+        }
+
+        template <StandardInteger T, StandardInteger U>
+        constexpr bool equal(T a, U b) noexcept
+        {
+            if constexpr (std::is_signed_v<T> == std::is_signed_v<U>)
+                return a == b;
+            else if constexpr (std::is_signed_v<T>)
+            {
+                if constexpr (sizeof(U) < sizeof(T))
+                    return a == static_cast<T>(b);
+                else
+                    return (a >= 0) & (static_cast<std::make_unsigned_t<T>>(a) == b);
+            }
+            else
+                return equal(b, a);
+        }
+
+        template <StandardInteger R, StandardInteger T>
+        constexpr bool in_range(T value) noexcept
+        {
+            constexpr bool min_fits = !less(std::numeric_limits<T>::min(), std::numeric_limits<R>::min());
+            constexpr bool max_fits = !less(std::numeric_limits<R>::max(), std::numeric_limits<T>::max());
+
+            if constexpr (min_fits && max_fits)
+                return true;
+            else if constexpr (min_fits)
+                return !less(std::numeric_limits<R>::max(), value);
+            else if constexpr (max_fits)
+                return !less(value, std::numeric_limits<R>::min());
+            else
+                return !less(value, std::numeric_limits<R>::min()) & !less(std::numeric_limits<R>::max(), value);
+        }
+
+        template <StandardInteger T>
+        using RangeBits = std::make_unsigned_t<T>;
+
+        // values of T that fit in R form an interval [lo, lo + 2^k) - value - lo has no bits set above k if it fits
+        // (equivalent of a min/max check that needs only subtraction, shift & OR - no 64-bit compares in SSE2)
+        template <StandardInteger R, StandardInteger T>
+        constexpr RangeBits<T> bits_outside_range(T value) noexcept
+        {
+            constexpr T lo = less(std::numeric_limits<T>::min(), std::numeric_limits<R>::min()) ? static_cast<T>(std::numeric_limits<R>::min()) : std::numeric_limits<T>::min();
+            constexpr T hi = less(std::numeric_limits<R>::max(), std::numeric_limits<T>::max()) ? static_cast<T>(std::numeric_limits<R>::max()) : std::numeric_limits<T>::max();
+            constexpr RangeBits<T> width = static_cast<RangeBits<T>>(static_cast<RangeBits<T>>(hi) - static_cast<RangeBits<T>>(lo));
+            constexpr int k = std::bit_width(width);
+            static_assert(std::has_single_bit(static_cast<RangeBits<T>>(width + 1)), "integer ranges are powers of 2");
+
+            return static_cast<RangeBits<T>>(static_cast<RangeBits<T>>(static_cast<RangeBits<T>>(value) - static_cast<RangeBits<T>>(lo)) >> k);
+        }
+
+        // column or single value seen as a column
+        template <IntegerColumn Rng>
+        auto column_of(const Rng& rng) noexcept
+        {
+            return std::span<const std::ranges::range_value_t<Rng>>{std::ranges::data(rng), std::ranges::size(rng)};
+        }
+
+        template <StandardInteger T>
+        auto column_of(T value) noexcept
+        {
+            struct Broadcast
+            {
+                T value;
+                T operator[](size_t) const noexcept { return value; }
+            };
+
+            return Broadcast{value};
+        }
+
+        template <ColumnOperand Lhs, ColumnOperand Rhs>
+        size_t column_size(const Lhs& lhs, const Rhs& rhs)
+        {
+            if constexpr (IntegerColumn<Lhs> && IntegerColumn<Rhs>)
+            {
+                assert(std::ranges::size(lhs) == std::ranges::size(rhs));
+                return std::ranges::size(lhs);
+            }
+            else if constexpr (IntegerColumn<Lhs>)
+                return std::ranges::size(lhs);
+            else
+                return std::ranges::size(rhs);
+        }
+
+        // 64 flags (0x00 or 0xFF) -> one word of bits
+        inline bits::Word pack_flags(const uint8_t* flags) noexcept
+        {
+#ifdef HELPERS_INTEGER_COMPARE_SSE2
+            bits::Word word = 0;
+            for (size_t v = 0; v < 4; ++v)
+            {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(flags + v * 16));
+                word |= static_cast<bits::Word>(static_cast<uint16_t>(_mm_movemask_epi8(chunk))) << (v * 16);
+            }
+            return word;
+#else
+            bits::Word word = 0;
+            for (size_t j = 0; j < bits::bits_per_word; ++j)
+                word |= static_cast<bits::Word>(flags[j] & 1) << j;
+            return word;
+#endif
+        }
+
+        template <typename Predicate>
+        void evaluate_into(size_t size, bits::DynamicBitset& result, Predicate pred)
+        {
+            assert(result.size() == size);
+
+            std::span<bits::Word> words = result.words();
+
+            size_t i = 0;
+            for (size_t w = 0; i + bits::bits_per_word <= size; ++w, i += bits::bits_per_word)
+            {
+                alignas(16) uint8_t flags[bits::bits_per_word];
+                for (size_t j = 0; j < bits::bits_per_word; ++j)
+                    flags[j] = static_cast<uint8_t>(-static_cast<int>(pred(i + j)));
+
+                words[w] = pack_flags(flags);
+            }
+
+            if (i < size)
+            {
+                bits::Word word = 0;
+                for (size_t j = 0; i + j < size; ++j)
+                    word |= static_cast<bits::Word>(pred(i + j)) << j;
+                words.back() = word;
+            }
+        }
+    } // namespace Details
+
+    ////////////////////////////////////////////////////////////////////////
+    // cmp_less
+
+    template <ColumnOperand Lhs, ColumnOperand Rhs>
+        requires IntegerColumn<Lhs> || IntegerColumn<Rhs>
+    void cmp_less(const Lhs& lhs, const Rhs& rhs, bits::DynamicBitset& result)
+    {
+        const auto a = Details::column_of(lhs);
+        const auto b = Details::column_of(rhs);
+        Details::evaluate_into(Details::column_size(lhs, rhs), result, [&](size_t i) { return Details::less(a[i], b[i]); });
+    }
+
+    template <ColumnOperand Lhs, ColumnOperand Rhs>
+        requires IntegerColumn<Lhs> || IntegerColumn<Rhs>
+    bits::DynamicBitset cmp_less(const Lhs& lhs, const Rhs& rhs)
+    {
+        bits::DynamicBitset result(Details::column_size(lhs, rhs));
+        cmp_less(lhs, rhs, result);
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // cmp_equal
+
+    template <ColumnOperand Lhs, ColumnOperand Rhs>
+        requires IntegerColumn<Lhs> || IntegerColumn<Rhs>
+    void cmp_equal(const Lhs& lhs, const Rhs& rhs, bits::DynamicBitset& result)
+    {
+        const auto a = Details::column_of(lhs);
+        const auto b = Details::column_of(rhs);
+        Details::evaluate_into(Details::column_size(lhs, rhs), result, [&](size_t i) { return Details::equal(a[i], b[i]); });
+    }
+
+    template <ColumnOperand Lhs, ColumnOperand Rhs>
+        requires IntegerColumn<Lhs> || IntegerColumn<Rhs>
+    bits::DynamicBitset cmp_equal(const Lhs& lhs, const Rhs& rhs)
+    {
+        bits::DynamicBitset result(Details::column_size(lhs, rhs));
+        cmp_equal(lhs, rhs, result);
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // in_range
+
+    template <StandardInteger R, IntegerColumn Rng>
+    void in_range(const Rng& column, bits::DynamicBitset& result)
+    {
+        const auto values = Details::column_of(column);
+        Details::evaluate_into(values.size(), result, [&](size_t i) { return Details::in_range<R>(values[i]); });
+    }
+
+    template <StandardInteger R, IntegerColumn Rng>
+    bits::DynamicBitset in_range(const Rng& column)
+    {
+        bits::DynamicBitset result(std::ranges::size(column));
+        in_range<R>(column, result);
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // select - indexes of set bits written to a selection vector; returns number of selected rows
+
+    template <std::unsigned_integral Index>
+    size_t select(const bits::DynamicBitset& mask, std::span<Index> indexes)
+    {
+        assert(mask.size() == 0 || mask.size() - 1 <= std::numeric_limits<Index>::max());
+
+        const std::span<const bits::Word> words = mask.words();
+
+        size_t count = 0;
+        for (size_t w = 0; w < words.size(); ++w)
+        {
+            for (bits::Word word = words[w]; word != 0; word &= word - 1) // clears the lowest set bit
+            {
+                assert(count < indexes.size());
+                indexes[count++] = static_cast<Index>(w * bits::bits_per_word + std::countr_zero(word));
+            }
+        }
+
+        return count;
+    }
+
+    template <std::unsigned_integral Index = uint32_t>
+    std::vector<Index> select(const bits::DynamicBitset& mask)
+    {
+        std::vector<Index> indexes(bits::count(mask));
+        select(mask, std::span<Index>{indexes});
+        return indexes;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // narrow_into - checked conversion of a column to a narrower type
+    //   returns the number of converted values - the index of the first value out of range of To
+    //   (from.size() if all values were converted)
+
+    template <IntegerColumn InRng, IntegerColumn OutRng>
+        requires std::ranges::output_range<OutRng, std::ranges::range_value_t<OutRng>>
+    size_t narrow_into(const InRng& from, OutRng&& to)
+    {
+        using From = std::ranges::range_value_t<InRng>;
+        using To = std::ranges::range_value_t<OutRng>;
+
+        const std::span<const From> src = Details::column_of(from);
+        const std::span<To> dest{std::ranges::data(to), std::ranges::size(to)};
+        assert(dest.size() >= src.size());
+
+        if constexpr (Details::in_range<To>(std::numeric_limits<From>::min()) && Details::in_range<To>(std::numeric_limits<From>::max()))
+        {
+            std::ranges::transform(src, dest.begin(), [](From value) { return static_cast<To>(value); }); // every From fits in To
+            return src.size();
+        }
+        else
+        {
+            constexpr size_t block_size = 4096 / sizeof(From); // validated block stays in L1 cache for the copy
+
+            // loops with a constant trip count vectorize also at -O2
+            size_t first = 0;
+            for (; first + block_size <= src.size(); first += block_size)
+            {
+                const From* block = src.data() + first;
+
+                Details::RangeBits<From> outside = 0;
+                for (size_t i = 0; i < block_size; ++i)
+                    outside |= Details::bits_outside_range<To>(block[i]);
+
+                if (outside != 0)
+                    break;
+
+                To* out = dest.data() + first;
+                for (size_t i = 0; i < block_size; ++i)
+                    out[i] = static_cast<To>(block[i]);
+            }
+
+            // block with a value out of range & the tail are converted one by one
+            for (; first < src.size(); ++first)
+            {
+                if (!Details::in_range<To>(src[first]))
+                    return first;
+                dest[first] = static_cast<To>(src[first]);
+            }
+
+            return src.size();
+        }
+    }
+
+    // throws std::out_of_range if any value does not fit in To
+    template <StandardInteger To, IntegerColumn InRng>
+    std::vector<To> narrow(const InRng& from)
+    {
+        std::vector<To> result(std::ranges::size(from));
+
+        if (const size_t converted = narrow_into(from, result); converted != result.size())
+            throw std::out_of_range("Value at index " + std::to_string(converted) + " is out of range of the target type");
+
+        return result;
+    }
+} // namespace helpers
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef LEXICOGRAPHICAL_COMPARE_HPP
+#define LEXICOGRAPHICAL_COMPARE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HELPERS_LEXICOGRAPHICAL_COMPARE_SSE2
+#endif
+
+namespace helpers
+{
+    /*********************
+    Three-way comparison and equality of contiguous buffers
+    - the first mismatch is searched in blocks of 64 bytes - equality masks of four SSE2 vectors are combined
+      and the exact position is computed only in the mismatching block
+    - equality of integers and ordering of unsigned bytes are delegated to memcmp
+    - integers and bytes are compared bitwise, floats with floating point equality (-0.0 == 0.0, NaN != NaN),
+      so results are the same as of std::lexicographical_compare_three_way and std::equal
+    **********************/
+
+    template <typename T>
+    concept SimdComparable = std::integral<T> || std::same_as<T, std::byte> || std::same_as<T, float> || std::same_as<T, double>;
+
+    namespace Details
+    {
+#ifdef HELPERS_LEXICOGRAPHICAL_COMPARE_SSE2
+        // bit set for each equal lane (byte for integers, element for floating point types)
+        template <SimdComparable T>
+        uint32_t equal_mask(const T* a, const T* b) noexcept
+        {
+            if constexpr (std::same_as<T, float>)
+                return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a), _mm_loadu_ps(b))));
+            else if constexpr (std::same_as<T, double>)
+                return static_cast<uint32_t>(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a), _mm_loadu_pd(b))));
+            else
+            {
+                const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+                const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+            }
+        }
+
+        template <SimdComparable T>
+        constexpr size_t lanes_per_item = std::floating_point<T> ? 1 : sizeof(T);
+#endif
+
+        template <SimdComparable T>
+        size_t mismatch_index(const T* a, const T* b, size_t size) noexcept
+        {
+            size_t i = 0;
+
+#ifdef HELPERS_LEXICOGRAPHICAL_COMPARE_SSE2
+            constexpr size_t items_per_vector = 16 / sizeof(T);
+            constexpr size_t vectors_per_block = 4;
+            constexpr uint32_t all_equal = (1u << (items_per_vector * lanes_per_item<T>)) - 1;
+
+            for (; i + vectors_per_block * items_per_vector <= size; i += vectors_per_block * items_per_vector)
+            {
+                uint32_t masks[vectors_per_block];
+                for (size_t v = 0; v < vectors_per_block; ++v)
+                    masks[v] = equal_mask(a + i + v * items_per_vector, b + i + v * items_per_vector);
+
+                if ((masks[0] & masks[1] & masks[2] & masks[3]) == all_equal)
+                    continue;
+
+                for (size_t v = 0; v < vectors_per_block; ++v)
+                    if (masks[v] != all_equal)
+                        return i + v * items_per_vector + std::countr_zero(~masks[v]) / lanes_per_item<T>;
+            }
+#else
+            // branch-free 'any' reduction over blocks of 64 bytes
+            constexpr size_t block_size = 64 / sizeof(T);
+
+            for (; i + block_size <= size; i += block_size)
+            {
+                bool differs = false;
+                for (size_t j = 0; j < block_size; ++j)
+                    differs |= !(a[i + j] == b[i + j]);
+
+                if (differs)
+                    break;
+            }
+#endif
+
+            for (; i < size; ++i)
+                if (!(a[i] == b[i]))
+                    return i;
+
+            return size;
+        }
+    } // namespace Details
+
+    template <SimdComparable T>
+    std::compare_three_way_result_t<T> compare_three_way(std::span<const T> a, std::span<const T> b) noexcept
+    {
+        const size_t size = std::min(a.size(), b.size());
+
+        if constexpr (sizeof(T) == 1 && (std::unsigned_integral<T> || std::same_as<T, std::byte>)) // order of memcmp
+        {
+            if (const int cmp = size == 0 ? 0 : std::memcmp(a.data(), b.data(), size); cmp != 0)
+                return cmp <=> 0;
+        }
+        else
+        {
+            if (const size_t pos = Details::mismatch_index(a.data(), b.data(), size); pos < size)
+                return a[pos] <=> b[pos];
+        }
+
+        return a.size() <=> b.size();
+    }
+
+    template <SimdComparable T>
+    bool equal(std::span<const T> a, std::span<const T> b) noexcept
+    {
+        if (a.size() != b.size())
+            return false;
+
+        if constexpr (std::floating_point<T>)
+            return Details::mismatch_index(a.data(), b.data(), a.size()) == a.size();
+        else // integers are equal if their bits are equal
+            return a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // ranges - contiguous ranges of the same SimdComparable type are compared with SIMD
+
+    template <typename Rng1, typename Rng2>
+    concept SimdComparableRanges = std::ranges::contiguous_range<Rng1> && std::ranges::sized_range<Rng1>
+        && std::ranges::contiguous_range<Rng2> && std::ranges::sized_range<Rng2>
+        && std::same_as<std::ranges::range_value_t<Rng1>, std::ranges::range_value_t<Rng2>>
+        && SimdComparable<std::ranges::range_value_t<Rng1>>;
+
+    template <std::ranges::input_range Rng1, std::ranges::input_range Rng2>
+    auto lexicographical_compare_three_way(Rng1&& rng1, Rng2&& rng2)
+    {
+        return std::lexicographical_compare_three_way(std::ranges::begin(rng1), std::ranges::end(rng1), std::ranges::begin(rng2), std::ranges::end(rng2));
+    }
+
+    template <std::ranges::input_range Rng1, std::ranges::input_range Rng2>
+        requires SimdComparableRanges<Rng1, Rng2>
+    auto lexicographical_compare_three_way(Rng1&& rng1, Rng2&& rng2)
+    {
+        using T = std::ranges::range_value_t<Rng1>;
+        return compare_three_way(std::span<const T>{std::ranges::data(rng1), std::ranges::size(rng1)}, std::span<const T>{std::ranges::data(rng2), std::ranges::size(rng2)});
+    }
+
+    template <std::ranges::input_range Rng1, std::ranges::input_range Rng2>
+    bool equal(Rng1&& rng1, Rng2&& rng2)
+    {
+        return std::ranges::equal(rng1, rng2);
+    }
+
+    template <std::ranges::input_range Rng1, std::ranges::input_range Rng2>
+        requires SimdComparableRanges<Rng1, Rng2>
+    bool equal(Rng1&& rng1, Rng2&& rng2)
+    {
+        using T = std::ranges::range_value_t<Rng1>;
+        return equal(std::span<const T>{std::ranges::data(rng1), std::ranges::size(rng1)}, std::span<const T>{std::ranges::data(rng2), std::ranges::size(rng2)});
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // lexicographic - adaptor that gives a range comparison operators
+    //   data1 | lexicographic <=> data2 | lexicographic
+
+    template <std::ranges::input_range Rng>
+    class Lexicographic
+    {
+        Rng& rng_;
+
+    public:
+        explicit Lexicographic(Rng& rng) noexcept
+            : rng_{rng}
+        {
+        }
+
+        Rng& base() const noexcept { return rng_; }
+
+        template <typename OtherRng>
+        bool operator==(const Lexicographic<OtherRng>& other) const
+        {
+            return helpers::equal(rng_, other.base());
+        }
+
+        template <typename OtherRng>
+        auto operator<=>(const Lexicographic<OtherRng>& other) const
+        {
+            return helpers::lexicographical_compare_three_way(rng_, other.base());
+        }
+    };
+
+    struct LexicographicFn
+    {
+        template <std::ranges::input_range Rng>
+        Lexicographic<std::remove_reference_t<Rng>> operator()(Rng& rng) const noexcept
+        {
+            return Lexicographic<std::remove_reference_t<Rng>>{rng};
+        }
+
+        template <std::ranges::input_range Rng>
+        friend Lexicographic<std::remove_reference_t<Rng>> operator|(Rng& rng, const LexicographicFn& fn) noexcept
+        {
+            return fn(rng);
+        }
+    };
+
+    inline constexpr LexicographicFn lexicographic;
+} // namespace helpers
+
+#endif
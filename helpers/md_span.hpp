@@ -0,0 +1,421 @@
+#ifndef MD_SPAN_HPP
+#define MD_SPAN_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace helpers
+{
+    /*********************
+    MdSpan - non-owning multidimensional view in the style of std::mdspan (C++23)
+    - Extents<E...> - extents known at compile time or std::dynamic_extent (stored only if dynamic)
+    - layouts map indexes to an offset in the underlying buffer:
+      * LayoutRight - row-major (C arrays)
+      * LayoutLeft - column-major (Fortran, BLAS)
+      * LayoutStride - arbitrary strides (blocks of other views)
+      * LayoutTiled<TileRows, TileCols> - 2D grid stored as contiguous row-major tiles - neighbours in both
+        directions share cache lines & pages
+    - for_each_tile() - cache-blocked iteration over a 2D index space
+    **********************/
+
+    template <size_t... Es>
+    class Extents
+    {
+        static constexpr std::array<size_t, sizeof...(Es)> static_extents_{Es...};
+
+    public:
+        static constexpr size_t rank() noexcept { return sizeof...(Es); }
+        static constexpr size_t rank_dynamic() noexcept { return ((Es == std::dynamic_extent) + ... + 0); }
+        static constexpr size_t static_extent(size_t r) noexcept { return static_extents_[r]; }
+
+        template <std::convertible_to<size_t>... DynamicExtents>
+            requires(sizeof...(DynamicExtents) == rank_dynamic())
+        constexpr explicit Extents(DynamicExtents... extents) noexcept
+            : dynamic_extents_{static_cast<size_t>(extents)...}
+        {
+        }
+
+        constexpr size_t extent(size_t r) const noexcept
+        {
+            assert(r < rank());
+            return static_extents_[r] == std::dynamic_extent ? dynamic_extents_[dynamic_index(r)] : static_extents_[r];
+        }
+
+        constexpr size_t size() const noexcept
+        {
+            size_t product = 1;
+            for (size_t r = 0; r < rank(); ++r)
+                product *= extent(r);
+            return product;
+        }
+
+        constexpr bool operator==(const Extents&) const = default;
+
+    private:
+        std::array<size_t, rank_dynamic()> dynamic_extents_{};
+
+        static constexpr size_t dynamic_index(size_t r) noexcept
+        {
+            return static_cast<size_t>(std::count(static_extents_.begin(), static_extents_.begin() + r, std::dynamic_extent));
+        }
+    };
+
+    namespace Details
+    {
+        template <size_t, size_t Extent>
+        constexpr size_t repeat_extent = Extent;
+
+        template <typename Indexes>
+        struct DynamicExtentsOf;
+
+        template <size_t... I>
+        struct DynamicExtentsOf<std::index_sequence<I...>>
+        {
+            using type = Extents<repeat_extent<I, std::dynamic_extent>...>;
+        };
+
+        template <typename TExtents, std::integral... Indexes>
+        constexpr bool in_bounds(const TExtents& extents, Indexes... indexes) noexcept
+        {
+            size_t r = 0;
+            return ((std::in_range<size_t>(indexes) && static_cast<size_t>(indexes) < extents.extent(r++)) && ...);
+        }
+    } // namespace Details
+
+    template <size_t Rank>
+    using DExtents = typename Details::DynamicExtentsOf<std::make_index_sequence<Rank>>::type;
+
+    ////////////////////////////////////////////////////////////////////////
+    // layouts
+
+    struct LayoutRight
+    {
+        template <typename TExtents>
+        class mapping
+        {
+            TExtents extents_;
+
+        public:
+            using extents_type = TExtents;
+
+            constexpr explicit mapping(const TExtents& extents) noexcept
+                : extents_{extents}
+            {
+            }
+
+            constexpr const TExtents& extents() const noexcept { return extents_; }
+
+            template <std::integral... Indexes>
+                requires(sizeof...(Indexes) == TExtents::rank())
+            constexpr size_t operator()(Indexes... indexes) const noexcept
+            {
+                size_t offset = 0;
+                size_t r = 0;
+                ((offset = offset * extents_.extent(r++) + static_cast<size_t>(indexes)), ...);
+                return offset;
+            }
+
+            constexpr size_t stride(size_t r) const noexcept
+            {
+                size_t stride = 1;
+                for (size_t next = r + 1; next < TExtents::rank(); ++next)
+                    stride *= extents_.extent(next);
+                return stride;
+            }
+
+            constexpr size_t required_span_size() const noexcept { return extents_.size(); }
+            constexpr bool is_exhaustive() const noexcept { return true; }
+        };
+    };
+
+    struct LayoutLeft
+    {
+        template <typename TExtents>
+        class mapping
+        {
+            TExtents extents_;
+
+        public:
+            using extents_type = TExtents;
+
+            constexpr explicit mapping(const TExtents& extents) noexcept
+                : extents_{extents}
+            {
+            }
+
+            constexpr const TExtents& extents() const noexcept { return extents_; }
+
+            template <std::integral... Indexes>
+                requires(sizeof...(Indexes) == TExtents::rank())
+            constexpr size_t operator()(Indexes... indexes) const noexcept
+            {
+                const std::array<size_t, TExtents::rank()> index{static_cast<size_t>(indexes)...};
+
+                size_t offset = 0;
+                for (size_t r = TExtents::rank(); r-- > 0;)
+                    offset = offset * extents_.extent(r) + index[r];
+                return offset;
+            }
+
+            constexpr size_t stride(size_t r) const noexcept
+            {
+                size_t stride = 1;
+                for (size_t prev = 0; prev < r; ++prev)
+                    stride *= extents_.extent(prev);
+                return stride;
+            }
+
+            constexpr size_t required_span_size() const noexcept { return extents_.size(); }
+            constexpr bool is_exhaustive() const noexcept { return true; }
+        };
+    };
+
+    struct LayoutStride
+    {
+        template <typename TExtents>
+        class mapping
+        {
+            TExtents extents_;
+            std::array<size_t, TExtents::rank()> strides_;
+
+        public:
+            using extents_type = TExtents;
+
+            constexpr mapping(const TExtents& extents, const std::array<size_t, TExtents::rank()>& strides) noexcept
+                : extents_{extents}
+                , strides_{strides}
+            {
+            }
+
+            // strides of any other strided layout
+            template <typename TMapping>
+                requires requires(const TMapping& m) { m.stride(0); } && std::same_as<typename TMapping::extents_type, TExtents>
+            constexpr explicit mapping(const TMapping& other) noexcept
+                : extents_{other.extents()}
+                , strides_{}
+            {
+                for (size_t r = 0; r < TExtents::rank(); ++r)
+                    strides_[r] = other.stride(r);
+            }
+
+            constexpr const TExtents& extents() const noexcept { return extents_; }
+
+            template <std::integral... Indexes>
+                requires(sizeof...(Indexes) == TExtents::rank())
+            constexpr size_t operator()(Indexes... indexes) const noexcept
+            {
+                size_t offset = 0;
+                size_t r = 0;
+                ((offset += static_cast<size_t>(indexes) * strides_[r++]), ...);
+                return offset;
+            }
+
+            constexpr size_t stride(size_t r) const noexcept { return strides_[r]; }
+
+            constexpr size_t required_span_size() const noexcept
+            {
+                size_t size = 1;
+                for (size_t r = 0; r < TExtents::rank(); ++r)
+                {
+                    if (extents_.extent(r) == 0)
+                        return 0;
+                    size += (extents_.extent(r) - 1) * strides_[r];
+                }
+                return size;
+            }
+
+            constexpr bool is_exhaustive() const noexcept { return required_span_size() == extents_.size(); }
+        };
+    };
+
+    // rows & columns are padded to whole tiles
+    template <size_t TileRows, size_t TileCols>
+        requires(std::has_single_bit(TileRows) && std::has_single_bit(TileCols))
+    struct LayoutTiled
+    {
+        static constexpr size_t tile_rows = TileRows;
+        static constexpr size_t tile_cols = TileCols;
+
+        template <typename TExtents>
+            requires(TExtents::rank() == 2)
+        class mapping
+        {
+            static constexpr size_t tile_size = TileRows * TileCols;
+
+            TExtents extents_;
+            size_t tiles_per_row_;
+
+        public:
+            using extents_type = TExtents;
+
+            constexpr explicit mapping(const TExtents& extents) noexcept
+                : extents_{extents}
+                , tiles_per_row_{(extents.extent(1) + TileCols - 1) / TileCols}
+            {
+            }
+
+            constexpr const TExtents& extents() const noexcept { return extents_; }
+
+            // divisions by powers of 2 are shifts
+            constexpr size_t operator()(std::integral auto row, std::integral auto col) const noexcept
+            {
+                const auto r = static_cast<size_t>(row);
+                const auto c = static_cast<size_t>(col);
+                return ((r / TileRows) * tiles_per_row_ + c / TileCols) * tile_size + (r % TileRows) * TileCols + c % TileCols;
+            }
+
+            constexpr size_t required_span_size() const noexcept
+            {
+                return (extents_.extent(0) + TileRows - 1) / TileRows * tiles_per_row_ * tile_size;
+            }
+
+            constexpr bool is_exhaustive() const noexcept { return required_span_size() == extents_.size(); }
+        };
+    };
+
+    ////////////////////////////////////////////////////////////////////////
+    // MdSpan
+
+    template <typename T, typename TExtents, typename TLayout = LayoutRight>
+    class MdSpan
+    {
+    public:
+        using element_type = T;
+        using extents_type = TExtents;
+        using layout_type = TLayout;
+        using mapping_type = typename TLayout::template mapping<TExtents>;
+
+        constexpr MdSpan(T* data, const mapping_type& mapping) noexcept
+            : data_{data}
+            , mapping_{mapping}
+        {
+        }
+
+        constexpr MdSpan(T* data, const TExtents& extents) noexcept
+            requires std::constructible_from<mapping_type, const TExtents&>
+            : MdSpan(data, mapping_type{extents})
+        {
+        }
+
+        template <std::convertible_to<size_t>... DynamicExtents>
+            requires(sizeof...(DynamicExtents) == TExtents::rank_dynamic()) && std::constructible_from<mapping_type, const TExtents&>
+        constexpr explicit MdSpan(T* data, DynamicExtents... extents) noexcept
+            : MdSpan(data, TExtents{extents...})
+        {
+        }
+
+        // buffer must be large enough for the layout (tiled layouts are padded)
+        template <std::convertible_to<size_t>... DynamicExtents>
+            requires(sizeof...(DynamicExtents) == TExtents::rank_dynamic()) && std::constructible_from<mapping_type, const TExtents&>
+        constexpr explicit MdSpan(std::span<T> buffer, DynamicExtents... extents) noexcept
+            : MdSpan(buffer.data(), TExtents{extents...})
+        {
+            assert(buffer.size() >= mapping_.required_span_size());
+        }
+
+        static constexpr size_t rank() noexcept { return TExtents::rank(); }
+
+        constexpr const TExtents& extents() const noexcept { return mapping_.extents(); }
+        constexpr size_t extent(size_t r) const noexcept { return extents().extent(r); }
+        constexpr size_t size() const noexcept { return extents().size(); }
+        constexpr bool empty() const noexcept { return size() == 0; }
+
+        constexpr const mapping_type& mapping() const noexcept { return mapping_; }
+        constexpr T* data_handle() const noexcept { return data_; }
+
+        template <std::integral... Indexes>
+            requires(sizeof...(Indexes) == rank())
+        constexpr T& operator[](Indexes... indexes) const noexcept
+        {
+            assert(Details::in_bounds(extents(), indexes...));
+            return data_[mapping_(indexes...)];
+        }
+
+        // underlying buffer - all items in storage order
+        constexpr std::span<T> buffer() const noexcept
+        {
+            return {data_, mapping_.required_span_size()};
+        }
+
+        // row of a row-major matrix
+        constexpr std::span<T> row(size_t r) const noexcept
+            requires(rank() == 2 && std::same_as<TLayout, LayoutRight>)
+        {
+            assert(r < extent(0));
+            return {data_ + mapping_(r, size_t{0}), extent(1)};
+        }
+
+        // column of a column-major matrix
+        constexpr std::span<T> column(size_t c) const noexcept
+            requires(rank() == 2 && std::same_as<TLayout, LayoutLeft>)
+        {
+            assert(c < extent(1));
+            return {data_ + mapping_(size_t{0}, c), extent(0)};
+        }
+
+        // rows x cols block of a strided matrix starting at (row, col)
+        constexpr MdSpan<T, DExtents<2>, LayoutStride> block(size_t row, size_t col, size_t rows, size_t cols) const noexcept
+            requires(rank() == 2 && requires(const mapping_type& m) { m.stride(0); })
+        {
+            assert(row + rows <= extent(0) && col + cols <= extent(1));
+            return {data_ + mapping_(row, col), LayoutStride::mapping<DExtents<2>>{DExtents<2>{rows, cols}, {mapping_.stride(0), mapping_.stride(1)}}};
+        }
+
+        constexpr operator MdSpan<const T, TExtents, TLayout>() const noexcept
+            requires(!std::is_const_v<T>)
+        {
+            return {data_, mapping_};
+        }
+
+    private:
+        T* data_;
+        mapping_type mapping_;
+    };
+
+    template <typename T, std::convertible_to<size_t>... Extents>
+    MdSpan(T*, Extents...) -> MdSpan<T, DExtents<sizeof...(Extents)>>;
+
+    template <typename T, size_t Extent, std::convertible_to<size_t>... Extents>
+    MdSpan(std::span<T, Extent>, Extents...) -> MdSpan<T, DExtents<sizeof...(Extents)>>;
+
+    ////////////////////////////////////////////////////////////////////////
+    // cache-blocked iteration over 2D index space
+    //   f(row_first, col_first, rows, cols) is called for each tile - tiles are visited row by row
+
+    template <typename F>
+    void for_each_tile(size_t rows, size_t cols, size_t tile_rows, size_t tile_cols, F f)
+    {
+        assert(tile_rows > 0 && tile_cols > 0);
+
+        for (size_t row = 0; row < rows; row += tile_rows)
+            for (size_t col = 0; col < cols; col += tile_cols)
+                f(row, col, std::min(tile_rows, rows - row), std::min(tile_cols, cols - col));
+    }
+
+    // tiles match the tiles of the layout - each tile is a contiguous block of memory
+    template <typename T, typename TExtents, size_t TileRows, size_t TileCols, typename F>
+    void for_each_tile(const MdSpan<T, TExtents, LayoutTiled<TileRows, TileCols>>& md, F f)
+    {
+        for_each_tile(md.extent(0), md.extent(1), TileRows, TileCols, f);
+    }
+
+    // f(row, col) for all indexes - tile by tile
+    template <typename F>
+    void for_each_index_blocked(size_t rows, size_t cols, size_t tile_size, F f)
+    {
+        for_each_tile(rows, cols, tile_size, tile_size, [&](size_t row_first, size_t col_first, size_t tile_rows, size_t tile_cols) {
+            for (size_t row = row_first; row < row_first + tile_rows; ++row)
+                for (size_t col = col_first; col < col_first + tile_cols; ++col)
+                    f(row, col);
+        });
+    }
+} // namespace helpers
+
+#endif
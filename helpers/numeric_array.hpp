@@ -0,0 +1,372 @@
+#ifndef NUMERIC_ARRAY_HPP
+#define NUMERIC_ARRAY_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// element-wise loops have no loop-carried dependencies - a = a * a + b may be vectorized without alias checks
+#if defined(__clang__)
+#define HELPERS_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define HELPERS_IVDEP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#define HELPERS_IVDEP __pragma(loop(ivdep))
+#else
+#define HELPERS_IVDEP
+#endif
+
+namespace helpers
+{
+    /*********************
+    NumericArray<T, Extent> - array of numbers with lazy element-wise arithmetic (expression templates)
+    - a * a + b * 2.0f builds an expression object - nothing is computed until it is assigned to a NumericArray;
+      all terms are then evaluated in a single loop without temporary arrays
+    - operands: NumericArrays (held by reference - expressions must not outlive them), expressions (held by value)
+      & scalars; unary minus, +, -, *, /
+    - arange<T, N>(start) / arange<T>(size, start) - lazy sequence start, start + 1, ... (fused std::iota)
+    - storage: std::array<T, Extent> for a fixed extent (constexpr variables), std::vector<T> for std::dynamic_extent;
+      both may be used during constant evaluation
+    - sizes of operands must match - mismatch is a compile error for fixed extents, std::invalid_argument otherwise
+    - evaluation loop runs in blocks with a constant trip count - it vectorizes also at -O2
+    **********************/
+
+    struct ArrayExpressionTag
+    {
+    };
+
+    template <typename E>
+    concept ArrayExpression = std::derived_from<std::remove_cvref_t<E>, ArrayExpressionTag>;
+
+    template <typename T>
+    concept Numeric = std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+    template <Numeric T, size_t Extent = std::dynamic_extent>
+    class NumericArray;
+
+    namespace Details
+    {
+        template <typename E>
+        constexpr bool is_numeric_array = false;
+
+        template <typename T, size_t Extent>
+        constexpr bool is_numeric_array<NumericArray<T, Extent>> = true;
+
+        // arrays are held by reference, expressions (lightweight) by value
+        template <typename E>
+        using ExpressionOperand = std::conditional_t<is_numeric_array<std::remove_cvref_t<E>>, const std::remove_cvref_t<E>&, std::remove_cvref_t<E>>;
+
+        template <Numeric T>
+        struct Scalar
+        {
+            T value;
+
+            constexpr T operator[](size_t) const noexcept { return value; }
+        };
+
+        template <typename E>
+        constexpr bool is_scalar = false;
+
+        template <typename T>
+        constexpr bool is_scalar<Scalar<T>> = true;
+
+        template <typename E>
+        constexpr size_t extent_of()
+        {
+            if constexpr (is_scalar<E>)
+                return std::dynamic_extent;
+            else
+                return E::extent;
+        }
+
+        template <typename L, typename R>
+        constexpr size_t common_extent()
+        {
+            constexpr size_t left = extent_of<L>();
+            constexpr size_t right = extent_of<R>();
+            static_assert(left == std::dynamic_extent || right == std::dynamic_extent || left == right, "NumericArray - sizes of operands do not match");
+
+            return left != std::dynamic_extent ? left : right;
+        }
+
+        template <typename Op, typename L, typename R>
+        class BinaryExpression : public ArrayExpressionTag
+        {
+            ExpressionOperand<L> left_;
+            ExpressionOperand<R> right_;
+
+        public:
+            using value_type = std::remove_cvref_t<decltype(Op{}(std::declval<L>()[0], std::declval<R>()[0]))>;
+            static constexpr size_t extent = common_extent<L, R>();
+
+            constexpr BinaryExpression(const L& left, const R& right)
+                : left_{left}
+                , right_{right}
+            {
+                if constexpr (!is_scalar<L> && !is_scalar<R>)
+                {
+                    if (left.size() != right.size())
+                        throw std::invalid_argument("NumericArray - sizes of operands do not match");
+                }
+            }
+
+            constexpr size_t size() const noexcept
+            {
+                if constexpr (is_scalar<L>)
+                    return right_.size();
+                else
+                    return left_.size();
+            }
+
+            constexpr value_type operator[](size_t index) const { return Op{}(left_[index], right_[index]); }
+        };
+
+        template <typename Op, typename E>
+        class UnaryExpression : public ArrayExpressionTag
+        {
+            ExpressionOperand<E> operand_;
+
+        public:
+            using value_type = std::remove_cvref_t<decltype(Op{}(std::declval<E>()[0]))>;
+            static constexpr size_t extent = E::extent;
+
+            constexpr explicit UnaryExpression(const E& operand)
+                : operand_{operand}
+            {
+            }
+
+            constexpr size_t size() const noexcept { return operand_.size(); }
+
+            constexpr value_type operator[](size_t index) const { return Op{}(operand_[index]); }
+        };
+
+        template <Numeric T, size_t Extent>
+        class Arange : public ArrayExpressionTag
+        {
+            size_t size_;
+            T start_;
+
+        public:
+            using value_type = T;
+            static constexpr size_t extent = Extent;
+
+            constexpr Arange(size_t size, T start)
+                : size_{size}
+                , start_{start}
+            {
+            }
+
+            constexpr size_t size() const noexcept { return size_; }
+
+            constexpr T operator[](size_t index) const { return static_cast<T>(start_ + static_cast<T>(index)); }
+        };
+
+        template <typename E>
+        constexpr decltype(auto) as_operand(const E& operand)
+        {
+            if constexpr (ArrayExpression<E>)
+                return (operand); // reference - arrays are not copied
+            else
+                return Scalar<E>{operand};
+        }
+
+        template <typename Op, typename L, typename R>
+        constexpr auto make_binary_expression(const L& left, const R& right)
+        {
+            using Left = std::remove_cvref_t<decltype(as_operand(left))>;
+            using Right = std::remove_cvref_t<decltype(as_operand(right))>;
+            return BinaryExpression<Op, Left, Right>{as_operand(left), as_operand(right)};
+        }
+
+        template <typename T, ArrayExpression E>
+        constexpr void evaluate(T* out, const E& expr, size_t size)
+        {
+            if (std::is_constant_evaluated())
+            {
+                for (size_t i = 0; i < size; ++i)
+                    out[i] = static_cast<T>(expr[i]);
+                return;
+            }
+
+            constexpr size_t block_size = 256 / sizeof(T);
+
+            size_t first = 0;
+            for (; first + block_size <= size; first += block_size)
+            {
+                HELPERS_IVDEP
+                for (size_t i = 0; i < block_size; ++i)
+                    out[first + i] = static_cast<T>(expr[first + i]);
+            }
+
+            for (; first < size; ++first)
+                out[first] = static_cast<T>(expr[first]);
+        }
+    } // namespace Details
+
+    template <typename L, typename R>
+    concept ExpressionOperands = (ArrayExpression<L> && (ArrayExpression<R> || Numeric<R>)) || (Numeric<L> && ArrayExpression<R>);
+
+    template <typename L, typename R>
+        requires ExpressionOperands<L, R>
+    constexpr auto operator+(const L& left, const R& right)
+    {
+        return Details::make_binary_expression<std::plus<>>(left, right);
+    }
+
+    template <typename L, typename R>
+        requires ExpressionOperands<L, R>
+    constexpr auto operator-(const L& left, const R& right)
+    {
+        return Details::make_binary_expression<std::minus<>>(left, right);
+    }
+
+    template <typename L, typename R>
+        requires ExpressionOperands<L, R>
+    constexpr auto operator*(const L& left, const R& right)
+    {
+        return Details::make_binary_expression<std::multiplies<>>(left, right);
+    }
+
+    template <typename L, typename R>
+        requires ExpressionOperands<L, R>
+    constexpr auto operator/(const L& left, const R& right)
+    {
+        return Details::make_binary_expression<std::divides<>>(left, right);
+    }
+
+    template <ArrayExpression E>
+    constexpr auto operator-(const E& operand)
+    {
+        return Details::UnaryExpression<std::negate<>, E>{operand};
+    }
+
+    template <Numeric T, size_t N>
+    constexpr auto arange(T start = T{})
+    {
+        return Details::Arange<T, N>{N, start};
+    }
+
+    template <Numeric T>
+    constexpr auto arange(size_t size, T start = T{})
+    {
+        return Details::Arange<T, std::dynamic_extent>{size, start};
+    }
+
+    template <Numeric T, size_t Extent>
+    class NumericArray : public ArrayExpressionTag
+    {
+        using Storage = std::conditional_t<Extent == std::dynamic_extent, std::vector<T>, std::array<T, Extent>>;
+
+        Storage items_{};
+
+    public:
+        using value_type = T;
+        static constexpr size_t extent = Extent;
+
+        constexpr NumericArray() = default;
+
+        constexpr explicit NumericArray(size_t size, T value = T{})
+            requires(Extent == std::dynamic_extent)
+            : items_(size, value)
+        {
+        }
+
+        constexpr NumericArray(std::initializer_list<T> items)
+        {
+            if constexpr (Extent == std::dynamic_extent)
+                items_.assign(items);
+            else
+            {
+                if (items.size() != Extent)
+                    throw std::invalid_argument("NumericArray - wrong number of items");
+                std::ranges::copy(items, items_.begin());
+            }
+        }
+
+        template <ArrayExpression E>
+            requires(!std::same_as<E, NumericArray>)
+        constexpr NumericArray(const E& expr)
+        {
+            static_assert(Extent == std::dynamic_extent || E::extent == std::dynamic_extent || E::extent == Extent, "NumericArray - sizes of operands do not match");
+
+            if constexpr (Extent == std::dynamic_extent)
+                items_.resize(expr.size());
+            else if (expr.size() != Extent)
+                throw std::invalid_argument("NumericArray - sizes of operands do not match");
+
+            Details::evaluate(items_.data(), expr, size());
+        }
+
+        // expression may refer to this array - items are read & written at the same index
+        template <ArrayExpression E>
+            requires(!std::same_as<E, NumericArray>)
+        constexpr NumericArray& operator=(const E& expr)
+        {
+            if (expr.size() != size())
+            {
+                if constexpr (Extent == std::dynamic_extent)
+                    items_.resize(expr.size());
+                else
+                    throw std::invalid_argument("NumericArray - sizes of operands do not match");
+            }
+
+            Details::evaluate(items_.data(), expr, size());
+            return *this;
+        }
+
+        template <typename E>
+            requires ArrayExpression<E> || Numeric<E>
+        constexpr NumericArray& operator+=(const E& other)
+        {
+            return *this = *this + other;
+        }
+
+        template <typename E>
+            requires ArrayExpression<E> || Numeric<E>
+        constexpr NumericArray& operator-=(const E& other)
+        {
+            return *this = *this - other;
+        }
+
+        template <typename E>
+            requires ArrayExpression<E> || Numeric<E>
+        constexpr NumericArray& operator*=(const E& other)
+        {
+            return *this = *this * other;
+        }
+
+        template <typename E>
+            requires ArrayExpression<E> || Numeric<E>
+        constexpr NumericArray& operator/=(const E& other)
+        {
+            return *this = *this / other;
+        }
+
+        constexpr size_t size() const noexcept { return items_.size(); }
+        constexpr bool empty() const noexcept { return items_.empty(); }
+
+        constexpr T& operator[](size_t index) { return items_[index]; }
+        constexpr const T& operator[](size_t index) const { return items_[index]; }
+
+        constexpr T* data() noexcept { return items_.data(); }
+        constexpr const T* data() const noexcept { return items_.data(); }
+
+        constexpr auto begin() noexcept { return items_.begin(); }
+        constexpr auto end() noexcept { return items_.end(); }
+        constexpr auto begin() const noexcept { return items_.begin(); }
+        constexpr auto end() const noexcept { return items_.end(); }
+
+        constexpr std::span<const T, Extent> span() const noexcept { return std::span<const T, Extent>{items_.data(), size()}; }
+
+        friend constexpr bool operator==(const NumericArray& left, const NumericArray& right) { return left.items_ == right.items_; }
+    };
+} // namespace helpers
+
+#endif
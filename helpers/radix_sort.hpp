@@ -0,0 +1,249 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace helpers
+{
+    /*********************
+    radix_sort - LSD radix sort for types ordered lexicographically by their members
+    - members are taken from:
+      1. radix_members(obj) found by ADL - returns std::tie of members in the order used by operator<=>;
+         class types must opt in this way - their declaration order says nothing about a custom operator<=>
+      2. the value itself - integral, floating point and enum types
+    - members are encoded as unsigned integers with the same order (signed - sign bit flipped,
+      floating point - negative values inverted; -0.0 is ordered before +0.0, NaNs are ordered at the ends)
+    - passes over digits equal in all items are skipped
+    - large inputs are histogrammed and scattered in chunks on separate threads
+    **********************/
+
+    template <typename T>
+    concept RadixKey = std::integral<T> || std::is_enum_v<T> || (std::floating_point<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+    namespace Details
+    {
+        template <typename T>
+        concept HasRadixMembers = requires(const T& obj) { radix_members(obj); };
+
+        template <typename Tuple>
+        constexpr bool all_radix_keys = []<size_t... I>(std::index_sequence<I...>) {
+            return (RadixKey<std::remove_cvref_t<std::tuple_element_t<I, Tuple>>> && ...);
+        }(std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+    } // namespace Details
+
+    template <typename T>
+    auto members_of(const T& obj)
+    {
+        if constexpr (Details::HasRadixMembers<T>)
+            return radix_members(obj);
+        else
+            return std::tie(obj);
+    }
+
+    // radix_members only describes the order - T must define it with comparison operators
+    template <typename T>
+    concept RadixSortable = std::copyable<T> && std::totally_ordered<T>
+        && (Details::HasRadixMembers<T> || RadixKey<T>)
+        && Details::all_radix_keys<decltype(members_of(std::declval<const T&>()))>;
+
+    // unsigned integer with the same order as value
+    template <RadixKey T>
+    constexpr auto radix_encode(T value) noexcept
+    {
+        if constexpr (std::is_enum_v<T>)
+            return radix_encode(std::to_underlying(value));
+        else if constexpr (std::same_as<T, bool>)
+            return static_cast<uint8_t>(value);
+        else if constexpr (std::unsigned_integral<T>)
+            return value;
+        else if constexpr (std::signed_integral<T>)
+        {
+            using U = std::make_unsigned_t<T>;
+            return static_cast<U>(static_cast<U>(value) ^ (U{1} << (sizeof(T) * 8 - 1)));
+        }
+        else
+        {
+            using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            constexpr U sign_bit = U{1} << (sizeof(T) * 8 - 1);
+
+            const U bits = std::bit_cast<U>(value);
+            return static_cast<U>((bits & sign_bit) ? ~bits : (bits | sign_bit));
+        }
+    }
+
+    namespace Details
+    {
+        template <typename T>
+        using RadixMembers = decltype(members_of(std::declval<const T&>()));
+
+        struct RadixPass
+        {
+            size_t member;
+            unsigned shift;
+        };
+
+        // least significant byte of the last member first
+        template <typename T>
+        constexpr auto radix_passes()
+        {
+            using Members = RadixMembers<T>;
+            constexpr size_t member_count = std::tuple_size_v<Members>;
+
+            constexpr size_t pass_count = []<size_t... I>(std::index_sequence<I...>) {
+                return (sizeof(std::remove_cvref_t<std::tuple_element_t<I, Members>>) + ...);
+            }(std::make_index_sequence<member_count>{});
+
+            constexpr std::array<size_t, member_count> member_sizes = []<size_t... I>(std::index_sequence<I...>) {
+                return std::array<size_t, member_count>{sizeof(std::remove_cvref_t<std::tuple_element_t<I, Members>>)...};
+            }(std::make_index_sequence<member_count>{});
+
+            std::array<RadixPass, pass_count> passes{};
+            size_t pass = 0;
+            for (size_t member = member_count; member-- > 0;)
+                for (unsigned byte = 0; byte < member_sizes[member]; ++byte)
+                    passes[pass++] = RadixPass{member, byte * 8};
+
+            return passes;
+        }
+
+        template <typename T, size_t Pass>
+        size_t radix_digit(const T& item) noexcept
+        {
+            constexpr RadixPass pass = radix_passes<T>()[Pass];
+            return static_cast<size_t>((radix_encode(std::get<pass.member>(members_of(item))) >> pass.shift) & 0xFF);
+        }
+
+        using RadixHistogram = std::array<size_t, 256>;
+
+        inline size_t radix_thread_count(size_t size)
+        {
+            constexpr size_t min_chunk_size = 1 << 20;
+
+            static const size_t hardware_threads = std::max(1u, std::thread::hardware_concurrency()); // query is a syscall
+            return std::clamp<size_t>(size / min_chunk_size, 1, hardware_threads);
+        }
+
+        template <typename F>
+        void for_each_chunk(size_t size, size_t thread_count, F f)
+        {
+            if (thread_count == 1)
+            {
+                f(size_t{0}, size_t{0}, size);
+                return;
+            }
+
+            const size_t chunk_size = size / thread_count;
+
+            std::vector<std::jthread> threads;
+            threads.reserve(thread_count - 1);
+            for (size_t chunk = 1; chunk < thread_count; ++chunk)
+            {
+                const size_t first = chunk * chunk_size;
+                const size_t last = chunk + 1 == thread_count ? size : first + chunk_size;
+                threads.emplace_back([=, &f] { f(chunk, first, last); });
+            }
+
+            f(size_t{0}, size_t{0}, chunk_size);
+        }
+
+        // returns true if items were moved to dest
+        template <size_t Pass, typename T>
+        bool radix_pass(std::span<const T> src, std::span<T> dest, const RadixHistogram& histogram, size_t thread_count)
+        {
+            if (std::ranges::find(histogram, src.size()) != histogram.end()) // all items have the same digit
+                return false;
+
+            std::vector<RadixHistogram> chunk_offsets(thread_count);
+
+            if (thread_count == 1)
+                std::exclusive_scan(histogram.begin(), histogram.end(), chunk_offsets[0].begin(), size_t{0});
+            else
+            {
+                for_each_chunk(src.size(), thread_count, [&](size_t chunk, size_t first, size_t last) {
+                    RadixHistogram& counts = chunk_offsets[chunk];
+                    counts.fill(0);
+                    for (size_t i = first; i < last; ++i)
+                        ++counts[radix_digit<T, Pass>(src[i])];
+                });
+
+                // items with digit d from chunk c are placed after items with smaller digits and after items with digit d from chunks < c
+                size_t offset = 0;
+                for (size_t digit = 0; digit < 256; ++digit)
+                    for (RadixHistogram& counts : chunk_offsets)
+                        offset += std::exchange(counts[digit], offset);
+            }
+
+            for_each_chunk(src.size(), thread_count, [&](size_t chunk, size_t first, size_t last) {
+                RadixHistogram& offsets = chunk_offsets[chunk];
+                for (size_t i = first; i < last; ++i)
+                    dest[offsets[radix_digit<T, Pass>(src[i])]++] = src[i];
+            });
+
+            return true;
+        }
+
+        template <typename T, size_t... Passes>
+        void radix_sort(std::span<T> data, std::index_sequence<Passes...>)
+        {
+            const size_t thread_count = radix_thread_count(data.size());
+
+            // histograms of all passes are computed in a single scan
+            std::vector<std::array<RadixHistogram, sizeof...(Passes)>> chunk_histograms(thread_count);
+            for_each_chunk(data.size(), thread_count, [&](size_t chunk, size_t first, size_t last) {
+                auto& histograms = chunk_histograms[chunk];
+                for (auto& histogram : histograms)
+                    histogram.fill(0);
+
+                for (size_t i = first; i < last; ++i)
+                    ((++histograms[Passes][radix_digit<T, Passes>(data[i])]), ...);
+            });
+
+            std::array<RadixHistogram, sizeof...(Passes)> histograms = chunk_histograms[0];
+            for (size_t chunk = 1; chunk < thread_count; ++chunk)
+                for (size_t pass = 0; pass < histograms.size(); ++pass)
+                    std::ranges::transform(histograms[pass], chunk_histograms[chunk][pass], histograms[pass].begin(), std::plus{});
+
+            std::vector<T> buffer(data.begin(), data.end());
+            std::span<T> src = data;
+            std::span<T> dest = buffer;
+
+            auto run_pass = [&]<size_t Pass>(std::integral_constant<size_t, Pass>) {
+                if (radix_pass<Pass, T>(src, dest, histograms[Pass], thread_count))
+                    std::swap(src, dest);
+            };
+
+            (run_pass(std::integral_constant<size_t, Passes>{}), ...);
+
+            if (src.data() != data.data())
+                std::ranges::copy(src, data.begin());
+        }
+    } // namespace Details
+
+    template <std::ranges::contiguous_range Rng>
+        requires std::ranges::sized_range<Rng> && RadixSortable<std::ranges::range_value_t<Rng>>
+    void radix_sort(Rng&& rng)
+    {
+        using T = std::ranges::range_value_t<Rng>;
+
+        if (std::ranges::size(rng) < 2)
+            return;
+
+        constexpr size_t pass_count = Details::radix_passes<T>().size();
+        Details::radix_sort(std::span<T>{std::ranges::data(rng), std::ranges::size(rng)}, std::make_index_sequence<pass_count>{});
+    }
+} // namespace helpers
+
+#endif
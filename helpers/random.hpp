@@ -29,16 +29,39 @@ namespace helpers::random
             return pcg32_random_r();
         }
 
-        static result_type min()
+        static constexpr result_type min()
         {
             return std::numeric_limits<result_type>::min();
         }
 
-        static result_type max()
+        static constexpr result_type max()
         {
             return std::numeric_limits<result_type>::max();
         }
 
+        // jump ahead by delta steps in O(log delta) - generation can start in the middle of a sequence
+        constexpr void advance(std::uint64_t delta)
+        {
+            std::uint64_t cur_mult = 6364126223846793005ULL;
+            std::uint64_t cur_plus = rng.inc | 1;
+            std::uint64_t acc_mult = 1;
+            std::uint64_t acc_plus = 0;
+
+            while (delta > 0)
+            {
+                if (delta & 1)
+                {
+                    acc_mult *= cur_mult;
+                    acc_plus = acc_plus * cur_mult + cur_plus;
+                }
+                cur_plus = (cur_mult + 1) * cur_plus;
+                cur_mult *= cur_mult;
+                delta /= 2;
+            }
+
+            rng.state = acc_mult * rng.state + acc_plus;
+        }
+
     private:
         constexpr std::uint32_t pcg32_random_r()
         {
@@ -0,0 +1,273 @@
+#ifndef SERIALIZATION_HPP
+#define SERIALIZATION_HPP
+
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace helpers
+{
+    /*********************
+    Binary serialization of trivially copyable types directly into/out of byte spans
+    - wire format is little-endian - on little-endian hosts values are copied with memcpy (spans in a single call),
+      on big-endian hosts scalars, arrays & aggregates (member by member) are byte swapped - members are taken from
+      wire_members(obj) found by ADL (std::tie of members) or structured bindings (aggregates without array members)
+    - padding bytes of structs are copied as they are
+    - pointers & types that hold addresses (std::string_view, std::span) are rejected at compile time - members
+      of structs are checked recursively where they can be listed (wire_members or structured bindings);
+      other class types (e.g. more than 8 members, base classes, array members) are accepted unchecked
+    - BinaryReader::view<T>() reads in place - returns a span of T over the buffer (e.g. a memory-mapped file)
+      without copying; data must be aligned for T (see align())
+    - reading/writing past the end of a buffer throws std::out_of_range
+    **********************/
+
+    namespace Details
+    {
+        constexpr bool native_wire_format = std::endian::native == std::endian::little;
+
+        template <typename T>
+        concept HasWireMembers = requires(T& obj) { wire_members(obj); };
+
+        template <typename T>
+        constexpr bool holds_address = std::is_pointer_v<T> || std::is_member_pointer_v<T>;
+
+        template <typename TChar, typename TTraits>
+        constexpr bool holds_address<std::basic_string_view<TChar, TTraits>> = true;
+
+        template <typename TItem, size_t Extent>
+        constexpr bool holds_address<std::span<TItem, Extent>> = true;
+
+        template <typename T>
+        constexpr bool is_std_array = false;
+
+        template <typename TItem, size_t N>
+        constexpr bool is_std_array<std::array<TItem, N>> = true;
+
+        template <typename T>
+        constexpr bool is_wire_safe();
+
+        template <typename Tuple>
+        constexpr bool all_wire_safe = []<size_t... I>(std::index_sequence<I...>) {
+            return (is_wire_safe<std::remove_cvref_t<std::tuple_element_t<I, Tuple>>>() && ...);
+        }(std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+
+        // values that hold addresses (pointers, std::string_view, std::span) are meaningless on the wire -
+        // members of class types are checked if they can be listed (wire_members or structured bindings)
+        template <typename T>
+        constexpr bool is_wire_safe()
+        {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+                return true;
+            else if constexpr (holds_address<T>)
+                return false;
+            else if constexpr (std::is_array_v<T>)
+                return is_wire_safe<std::remove_cv_t<std::remove_all_extents_t<T>>>();
+            else if constexpr (is_std_array<T>)
+                return is_wire_safe<std::remove_cv_t<typename T::value_type>>();
+            else if constexpr (HasWireMembers<T>)
+                return all_wire_safe<decltype(wire_members(std::declval<T&>()))>;
+            else if constexpr (IntrospectableAggregate<T>)
+                return all_wire_safe<decltype(tie_members(std::declval<T&>()))>;
+            else
+                return std::is_class_v<T>;
+        }
+    } // namespace Details
+
+    template <typename T>
+    concept Serializable = std::is_trivially_copyable_v<T> && Details::is_wire_safe<std::remove_cv_t<T>>();
+
+    namespace Details
+    {
+        // converts between native & wire (little-endian) byte order
+        template <typename T>
+        void swap_bytes(T& value) noexcept
+        {
+            if constexpr (sizeof(T) == 1 || std::same_as<T, bool>)
+                return;
+            else if constexpr (std::integral<T>)
+                value = std::byteswap(value);
+            else if constexpr (std::is_enum_v<T>)
+            {
+                auto underlying = std::to_underlying(value);
+                swap_bytes(underlying);
+                value = static_cast<T>(underlying);
+            }
+            else if constexpr (std::floating_point<T>)
+            {
+                using TBits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+                value = std::bit_cast<T>(std::byteswap(std::bit_cast<TBits>(value)));
+            }
+            else if constexpr (std::is_array_v<T> || is_std_array<T>)
+            {
+                for (auto& item : value)
+                    swap_bytes(item);
+            }
+            else if constexpr (HasWireMembers<T>)
+                std::apply([](auto&... members) { (swap_bytes(members), ...); }, wire_members(value));
+            else if constexpr (IntrospectableAggregate<T>)
+                apply_to_members(value, [](auto&... members) { (swap_bytes(members), ...); });
+            else
+                static_assert(sizeof(T) == 0, "byte order of T cannot be converted - provide wire_members(T&)");
+        }
+    } // namespace Details
+
+    class BinaryWriter
+    {
+        std::span<std::byte> buffer_;
+        size_t position_ = 0;
+
+        std::byte* reserve(size_t size)
+        {
+            if (size > buffer_.size() - position_)
+                throw std::out_of_range("BinaryWriter - buffer is too small");
+
+            return buffer_.data() + std::exchange(position_, position_ + size);
+        }
+
+    public:
+        explicit BinaryWriter(std::span<std::byte> buffer) noexcept
+            : buffer_{buffer}
+        {
+        }
+
+        size_t position() const noexcept { return position_; }
+        std::span<std::byte> written() const noexcept { return buffer_.first(position_); }
+
+        // zero padding up to the next multiple of alignment (relative to the beginning of the buffer)
+        void align(size_t alignment)
+        {
+            const size_t padding = (alignment - position_ % alignment) % alignment;
+            std::memset(reserve(padding), 0, padding);
+        }
+
+        template <Serializable T>
+        void write(const T& value)
+        {
+            std::byte* dest = reserve(sizeof(T));
+
+            if constexpr (Details::native_wire_format)
+                std::memcpy(dest, &value, sizeof(T));
+            else
+            {
+                T wire_value = value;
+                Details::swap_bytes(wire_value);
+                std::memcpy(dest, &wire_value, sizeof(T));
+            }
+        }
+
+        template <Serializable T>
+        void write(std::span<const T> values)
+        {
+            std::byte* dest = reserve(values.size_bytes());
+
+            if constexpr (Details::native_wire_format)
+            {
+                if (!values.empty())
+                    std::memcpy(dest, values.data(), values.size_bytes());
+            }
+            else
+            {
+                for (const T& value : values)
+                {
+                    T wire_value = value;
+                    Details::swap_bytes(wire_value);
+                    std::memcpy(std::exchange(dest, dest + sizeof(T)), &wire_value, sizeof(T));
+                }
+            }
+        }
+
+        template <Serializable T>
+        void write(std::span<T> values)
+        {
+            write(std::span<const T>{values});
+        }
+    };
+
+    class BinaryReader
+    {
+        std::span<const std::byte> buffer_;
+        size_t position_ = 0;
+
+        const std::byte* consume(size_t size)
+        {
+            if (size > buffer_.size() - position_)
+                throw std::out_of_range("BinaryReader - unexpected end of buffer");
+
+            return buffer_.data() + std::exchange(position_, position_ + size);
+        }
+
+    public:
+        explicit BinaryReader(std::span<const std::byte> buffer) noexcept
+            : buffer_{buffer}
+        {
+        }
+
+        size_t position() const noexcept { return position_; }
+        size_t remaining() const noexcept { return buffer_.size() - position_; }
+
+        void align(size_t alignment)
+        {
+            consume((alignment - position_ % alignment) % alignment);
+        }
+
+        template <Serializable T>
+        T read()
+        {
+            T value;
+            std::memcpy(&value, consume(sizeof(T)), sizeof(T));
+
+            if constexpr (!Details::native_wire_format)
+                Details::swap_bytes(value);
+
+            return value;
+        }
+
+        template <Serializable T>
+        void read(std::span<T> values)
+        {
+            const std::byte* src = consume(values.size_bytes());
+
+            if (!values.empty())
+                std::memcpy(values.data(), src, values.size_bytes());
+
+            if constexpr (!Details::native_wire_format)
+                std::ranges::for_each(values, [](T& value) { Details::swap_bytes(value); });
+        }
+
+        // items are read in place - the span is valid as long as the buffer
+        template <Serializable T>
+            requires Details::native_wire_format
+        std::span<const T> view(size_t count)
+        {
+            if (count > remaining() / sizeof(T))
+                throw std::out_of_range("BinaryReader - unexpected end of buffer");
+
+            const std::byte* src = buffer_.data() + position_;
+            if (reinterpret_cast<std::uintptr_t>(src) % alignof(T) != 0)
+                throw std::invalid_argument("BinaryReader - data is not aligned for in-place view");
+
+            consume(count * sizeof(T));
+
+#if defined(__cpp_lib_start_lifetime_as)
+            return {std::start_lifetime_as_array<T>(src, count), count};
+#else
+            return {reinterpret_cast<const T*>(src), count}; // objects of trivially copyable types are created implicitly
+#endif
+        }
+    };
+} // namespace helpers
+
+#endif
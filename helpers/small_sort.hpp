@@ -0,0 +1,234 @@
+#ifndef SMALL_SORT_HPP
+#define SMALL_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace helpers
+{
+    /*********************
+    Sorting of small arrays with sorting networks
+    - small_sort<N>(items) - fixed sequence of compare-exchange operations generated at compile time
+      (Batcher's odd-even merge network - for N <= 32 within a few comparators of the best known networks)
+      * network is fully unrolled - no loops; for trivially copyable items there are no data dependent branches -
+        compare-exchange compiles to conditional moves (std::min/std::max are compiled to branches by GCC);
+        other items (e.g. std::string) are swapped in place without copies
+      * constexpr - may be used during constant evaluation
+    - small_sort(std::span<T> items) - dispatch of a runtime size <= max_small_sort_size to a network
+    - hybrid_sort(rng) - introsort (quicksort with median of three pivots, heapsort when recursion gets too deep)
+      with partitions of up to max_small_sort_size items sorted by networks
+    - sorting is not stable
+    **********************/
+
+    inline constexpr size_t max_small_sort_size = 32;
+
+    namespace Details
+    {
+        struct Comparator
+        {
+            size_t first;
+            size_t second;
+        };
+
+        // comparators of Batcher's odd-even merge sort for any n (comparators beyond n are dropped)
+        template <typename F>
+        constexpr void for_each_comparator(size_t n, F f)
+        {
+            for (size_t p = 1; p < n; p *= 2)
+                for (size_t k = p; k >= 1; k /= 2)
+                    for (size_t j = k % p; j + k < n; j += 2 * k)
+                        for (size_t i = 0; i < k && i + j + k < n; ++i)
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                                f(Comparator{i + j, i + j + k});
+        }
+
+        constexpr size_t comparator_count(size_t n)
+        {
+            size_t count = 0;
+            for_each_comparator(n, [&count](Comparator) { ++count; });
+            return count;
+        }
+
+        template <size_t N>
+        constexpr auto make_sorting_network()
+        {
+            std::array<Comparator, comparator_count(N)> network{};
+            size_t index = 0;
+            for_each_comparator(N, [&](Comparator c) { network[index++] = c; });
+            return network;
+        }
+
+        template <size_t N>
+        inline constexpr auto sorting_network = make_sorting_network<N>();
+
+        // copies of trivially copyable items are cheap - selected with conditional moves (cmov) instead of a branch
+        template <typename T>
+        concept BranchlessExchange = std::is_trivially_copyable_v<T> && std::default_initializable<T>;
+
+        template <typename T, typename Compare>
+        constexpr void compare_exchange(T& a, T& b, Compare& comp)
+        {
+            if constexpr (BranchlessExchange<T>)
+            {
+                const bool swap = std::invoke(comp, b, a);
+                T min = swap ? b : a;
+                T max = swap ? a : b;
+                a = min;
+                b = max;
+            }
+            else if (std::invoke(comp, b, a)) // other types (e.g. std::string) are swapped in place - no copies
+                std::ranges::swap(a, b);
+        }
+
+        template <size_t N, typename T, typename Compare, size_t... I>
+        constexpr void apply_network(T* items, Compare& comp, std::index_sequence<I...>)
+        {
+            constexpr auto& network = sorting_network<N>;
+
+            if constexpr (BranchlessExchange<T>)
+            {
+                // local copy - items are kept in registers between compare-exchanges instead of round trips through memory
+                std::array<T, N> local;
+                std::ranges::copy(items, items + N, local.begin());
+                (compare_exchange(local[network[I].first], local[network[I].second], comp), ...);
+                std::ranges::copy(local, items);
+            }
+            else
+                (compare_exchange(items[network[I].first], items[network[I].second], comp), ...);
+        }
+    } // namespace Details
+
+    template <size_t N, typename T, typename Compare = std::ranges::less>
+        requires(N <= max_small_sort_size) && std::copyable<T>
+    constexpr void small_sort(std::span<T, N> items, Compare comp = {})
+    {
+        Details::apply_network<N>(items.data(), comp, std::make_index_sequence<Details::sorting_network<N>.size()>{});
+    }
+
+    template <typename T, size_t N, typename Compare = std::ranges::less>
+    constexpr void small_sort(std::array<T, N>& items, Compare comp = {})
+    {
+        small_sort(std::span<T, N>{items}, std::move(comp));
+    }
+
+    namespace Details
+    {
+        template <typename T, typename Compare>
+        using SmallSortFunction = void (*)(T*, Compare&);
+
+        template <typename T, typename Compare, size_t... N>
+        constexpr auto make_small_sort_table(std::index_sequence<N...>)
+        {
+            return std::array<SmallSortFunction<T, Compare>, sizeof...(N)>{
+                [](T* items, Compare& comp) { small_sort(std::span<T, N>{items, N}, comp); }...};
+        }
+
+        // network for each size - indexed by the size of items
+        template <typename T, typename Compare>
+        inline constexpr auto small_sort_table = make_small_sort_table<T, Compare>(std::make_index_sequence<max_small_sort_size + 1>{});
+    } // namespace Details
+
+    template <typename T, typename Compare = std::ranges::less>
+        requires std::copyable<T>
+    constexpr void small_sort(std::span<T> items, Compare comp = {})
+    {
+        if (items.size() <= max_small_sort_size)
+            Details::small_sort_table<T, Compare>[items.size()](items.data(), comp);
+        else
+            std::ranges::sort(items, comp);
+    }
+
+    namespace Details
+    {
+        template <typename T, typename Compare>
+        constexpr T* partition_around_median(T* first, T* last, Compare& comp)
+        {
+            T* mid = first + (last - first) / 2;
+
+            // median of three is moved to the front
+            if (std::invoke(comp, *mid, *first))
+                std::ranges::swap(*mid, *first);
+            if (std::invoke(comp, *(last - 1), *mid))
+            {
+                std::ranges::swap(*(last - 1), *mid);
+                if (std::invoke(comp, *mid, *first))
+                    std::ranges::swap(*mid, *first);
+            }
+            std::ranges::swap(*first, *mid);
+
+            const T& pivot = *first;
+            T* left = first + 1;
+            T* right = last - 1;
+
+            while (true) // first & last - 1 are sentinels - the scans do not need bounds checks
+            {
+                while (std::invoke(comp, *left, pivot))
+                    ++left;
+                while (std::invoke(comp, pivot, *right))
+                    --right;
+                if (left >= right)
+                    break;
+                std::ranges::swap(*left++, *right--);
+            }
+
+            std::ranges::swap(*first, *right);
+            return right;
+        }
+
+        template <typename T, typename Compare>
+        constexpr void introsort(T* first, T* last, size_t depth_limit, Compare& comp)
+        {
+            while (static_cast<size_t>(last - first) > max_small_sort_size)
+            {
+                if (depth_limit-- == 0)
+                {
+                    std::ranges::make_heap(first, last, comp);
+                    std::ranges::sort_heap(first, last, comp);
+                    return;
+                }
+
+                T* pivot = partition_around_median(first, last, comp);
+
+                // recursion into the smaller part - stack depth is O(log n)
+                if (pivot - first < last - pivot)
+                {
+                    introsort(first, pivot, depth_limit, comp);
+                    first = pivot + 1;
+                }
+                else
+                {
+                    introsort(pivot + 1, last, depth_limit, comp);
+                    last = pivot;
+                }
+            }
+
+            small_sort(std::span<T>{first, last}, comp);
+        }
+    } // namespace Details
+
+    template <std::ranges::contiguous_range Rng, typename Compare = std::ranges::less>
+        requires std::ranges::sized_range<Rng> && std::sortable<std::ranges::iterator_t<Rng>, Compare>
+        && std::copyable<std::ranges::range_value_t<Rng>>
+    constexpr void hybrid_sort(Rng&& rng, Compare comp = {})
+    {
+        using T = std::remove_reference_t<std::ranges::range_reference_t<Rng>>;
+
+        std::span<T> items{std::ranges::data(rng), std::ranges::size(rng)};
+        if (items.empty())
+            return;
+
+        const size_t depth_limit = 2 * std::bit_width(items.size());
+        Details::introsort(items.data(), items.data() + items.size(), depth_limit, comp);
+    }
+} // namespace helpers
+
+#endif
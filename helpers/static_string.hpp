@@ -0,0 +1,101 @@
+#ifndef STATIC_STRING_HPP
+#define STATIC_STRING_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string_view>
+
+namespace helpers
+{
+    /*********************
+    Compile-time string processing
+    - StaticString<N> - string literal usable as a template parameter: template <StaticString Text> ...
+    - tokenization with the semantics of std::views::split (empty tokens are kept, empty text has no tokens):
+      * count_tokens(text, separator) & tokenize<Count>(text, separator) - constexpr, for any string_view
+      * token_offsets<Text, Separator> - std::array of {offset, length} of tokens computed by the compiler
+      * tokens<Text, Separator> - std::array of string_views into the template parameter object (static storage)
+    - pre-parsed tables (routes, config keys) cost nothing at runtime - no allocations, no scanning
+    **********************/
+
+    template <size_t N>
+    struct StaticString
+    {
+        char value[N]{};
+
+        constexpr StaticString(const char (&str)[N])
+        {
+            std::copy(str, str + N, value);
+        }
+
+        constexpr size_t size() const noexcept { return N - 1; }
+
+        constexpr std::string_view view() const noexcept { return {value, N - 1}; }
+
+        constexpr operator std::string_view() const noexcept { return view(); }
+
+        auto operator<=>(const StaticString&) const = default;
+
+        friend std::ostream& operator<<(std::ostream& out, const StaticString& str)
+        {
+            return out << str.view();
+        }
+    };
+
+    struct TokenOffset
+    {
+        uint32_t offset;
+        uint32_t length;
+
+        constexpr std::string_view in(std::string_view text) const noexcept { return text.substr(offset, length); }
+
+        bool operator==(const TokenOffset&) const = default;
+    };
+
+    [[nodiscard]] constexpr size_t count_tokens(std::string_view text, char separator) noexcept
+    {
+        if (text.empty())
+            return 0;
+
+        return static_cast<size_t>(std::ranges::count(text, separator)) + 1;
+    }
+
+    template <size_t Count>
+    [[nodiscard]] constexpr std::array<TokenOffset, Count> tokenize_offsets(std::string_view text, char separator)
+    {
+        std::array<TokenOffset, Count> offsets{};
+
+        size_t begin = 0;
+        size_t index = 0;
+        for (size_t i = 0; i <= text.size() && index < Count; ++i)
+        {
+            if (i == text.size() || text[i] == separator)
+            {
+                offsets[index++] = {static_cast<uint32_t>(begin), static_cast<uint32_t>(i - begin)};
+                begin = i + 1;
+            }
+        }
+
+        return offsets;
+    }
+
+    // Count must be equal to count_tokens(text, separator)
+    template <size_t Count>
+    [[nodiscard]] constexpr std::array<std::string_view, Count> tokenize(std::string_view text, char separator)
+    {
+        std::array<std::string_view, Count> tokens{};
+        std::ranges::transform(tokenize_offsets<Count>(text, separator), tokens.begin(), [text](TokenOffset token) { return token.in(text); });
+        return tokens;
+    }
+
+    template <StaticString Text, char Separator = ' '>
+    inline constexpr auto token_offsets = tokenize_offsets<count_tokens(Text.view(), Separator)>(Text.view(), Separator);
+
+    template <StaticString Text, char Separator = ' '>
+    inline constexpr auto tokens = tokenize<count_tokens(Text.view(), Separator)>(Text.view(), Separator);
+} // namespace helpers
+
+#endif
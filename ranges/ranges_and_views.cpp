@@ -1,10 +1,16 @@
 #include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <format>
 #include <helpers.hpp>
 #include <iostream>
 #include <map>
+#include <random>
 #include <ranges>
+#include <small_sort.hpp>
+#include <span>
+#include <static_string.hpp>
 #include <string>
 #include <vector>
 
@@ -213,6 +219,300 @@ TEST_CASE("split")
     helpers::print(tokens, "tokens");
 }
 
+TEST_CASE("split - compile time")
+{
+    static_assert(helpers::tokens<"abc,def,ghi", ','> == std::array{"abc"sv, "def"sv, "ghi"sv});
+    static_assert(helpers::tokens<",a,,b,", ','> == std::array{""sv, "a"sv, ""sv, "b"sv, ""sv});
+    static_assert(helpers::tokens<"", ','>.empty());
+    static_assert(helpers::token_offsets<"key = value"> == std::array<helpers::TokenOffset, 3>{{{0, 3}, {4, 1}, {6, 5}}});
+
+    SECTION("the same tokens as std::views::split")
+    {
+        constexpr std::string_view text = "abc,,def,ghi,";
+        constexpr auto tokens = helpers::tokenize<helpers::count_tokens(text, ',')>(text, ',');
+
+        CHECK(std::ranges::equal(tokens, tokenize(text, ',')));
+    }
+}
+
+// routing table parsed at compile time - segments of paths are static arrays of string_views
+struct Route
+{
+    std::span<const std::string_view> segments; // ":name" - matches any segment
+    int handler_id;
+};
+
+template <helpers::StaticString Path>
+constexpr Route route(int handler_id)
+{
+    return Route{helpers::tokens<Path, '/'>, handler_id};
+}
+
+bool matches(std::span<const std::string_view> route_segments, std::span<const std::string_view> path_segments)
+{
+    return std::ranges::equal(route_segments, path_segments, [](std::string_view route_segment, std::string_view path_segment) {
+        return route_segment.starts_with(':') || route_segment == path_segment;
+    });
+}
+
+int find_handler(std::span<const Route> routes, std::span<const std::string_view> path)
+{
+    auto pos = std::ranges::find_if(routes, [path](const Route& r) { return matches(r.segments, path); });
+    return pos != routes.end() ? pos->handler_id : -1;
+}
+
+// the same table tokenized at runtime on each lookup
+int find_handler(std::span<const std::pair<std::string_view, int>> routes, std::span<const std::string_view> path)
+{
+    for (const auto& [route_path, handler_id] : routes)
+    {
+        if (matches(tokenize(route_path, '/'), path))
+            return handler_id;
+    }
+    return -1;
+}
+
+constexpr std::array routes = {
+    route<"api/v1/users">(1),
+    route<"api/v1/users/:id">(2),
+    route<"api/v1/users/:id/orders">(3),
+    route<"api/v1/orders/:id">(4),
+    route<"api/v2/users/:id">(5),
+    route<"health">(6),
+};
+
+constexpr std::array<std::pair<std::string_view, int>, 6> runtime_routes = {{
+    {"api/v1/users", 1},
+    {"api/v1/users/:id", 2},
+    {"api/v1/users/:id/orders", 3},
+    {"api/v1/orders/:id", 4},
+    {"api/v2/users/:id", 5},
+    {"health", 6},
+}};
+
+TEST_CASE("routing table parsed at compile time")
+{
+    const std::vector<std::pair<std::string, int>> requests = {
+        {"api/v1/users/42/orders", 3}, {"api/v2/users/7", 5}, {"health", 6}, {"api/v1/users", 1}, {"api/v3/users", -1}};
+
+    for (const auto& [request, expected] : requests)
+    {
+        auto path = tokenize(request, '/');
+        CHECK(find_handler(routes, path) == expected);
+        CHECK(find_handler(runtime_routes, path) == expected);
+    }
+}
+
+TEST_CASE("routing table - benchmark", "[.benchmark]")
+{
+    constexpr size_t lookups = 100'000;
+
+    const std::array requests = {"api/v1/users/42/orders"sv, "api/v2/users/7"sv, "health"sv, "api/v1/orders/665"sv, "api/v3/users"sv};
+    std::vector<std::vector<std::string_view>> paths;
+    for (auto request : requests)
+        paths.push_back(tokenize(request, '/'));
+
+    BENCHMARK("pre-parsed routes")
+    {
+        int sum = 0;
+        for (size_t i = 0; i < lookups; ++i)
+            sum += find_handler(routes, paths[i % paths.size()]);
+        return sum;
+    };
+
+    BENCHMARK("routes tokenized at runtime")
+    {
+        int sum = 0;
+        for (size_t i = 0; i < lookups; ++i)
+            sum += find_handler(runtime_routes, paths[i % paths.size()]);
+        return sum;
+    };
+}
+
+////////////////////////////////////////////////////////////////////////
+// sorting networks
+
+TEST_CASE("small sort")
+{
+    SECTION("constexpr")
+    {
+        constexpr auto sorted = [] {
+            std::array data = {5, 3, 8, 1, 9, 2, 7};
+            helpers::small_sort(data);
+            return data;
+        }();
+
+        static_assert(sorted == std::array{1, 2, 3, 5, 7, 8, 9});
+    }
+
+    SECTION("all sequences of zeros & ones are sorted - network is valid for any input")
+    {
+        auto check_network = []<size_t N>(std::integral_constant<size_t, N>) {
+            for (uint32_t bits = 0; bits < (1u << N); ++bits)
+            {
+                std::array<int, N> data;
+                for (size_t i = 0; i < N; ++i)
+                    data[i] = (bits >> i) & 1;
+
+                helpers::small_sort(data);
+                if (!std::ranges::is_sorted(data))
+                    return false;
+            }
+            return true;
+        };
+
+        const bool all_valid = [&]<size_t... N>(std::index_sequence<N...>) {
+            return (check_network(std::integral_constant<size_t, N>{}) && ...);
+        }(std::make_index_sequence<17>{});
+
+        CHECK(all_valid);
+    }
+
+    SECTION("runtime size & custom comparator")
+    {
+        std::mt19937 rnd_gen{665};
+
+        for (size_t size = 0; size <= 40; ++size)
+        {
+            std::vector<std::string> words(size);
+            std::ranges::generate(words, [&] { return std::to_string(rnd_gen() % 100); });
+
+            auto expected = words;
+            std::ranges::sort(expected, std::greater{});
+
+            helpers::small_sort(std::span{words}, std::greater{});
+            CHECK(words == expected);
+        }
+    }
+}
+
+namespace
+{
+    struct Counted
+    {
+        inline static size_t copies = 0;
+
+        int value;
+
+        explicit Counted(int value) : value{value} {}
+        Counted(const Counted& other) : value{other.value} { ++copies; }
+        Counted& operator=(const Counted& other) { value = other.value; ++copies; return *this; }
+        Counted(Counted&&) noexcept = default;
+        Counted& operator=(Counted&&) noexcept = default;
+
+        bool operator<(const Counted& other) const { return value < other.value; }
+    };
+}
+
+TEST_CASE("hybrid sort")
+{
+    std::mt19937_64 rnd_gen{42};
+
+    auto check_sorted = [](std::vector<int> data) {
+        auto expected = data;
+        std::ranges::sort(expected);
+
+        helpers::hybrid_sort(data);
+        CHECK(data == expected);
+    };
+
+    for (size_t size : {0, 1, 31, 32, 33, 100, 1000, 100'000})
+    {
+        std::vector<int> data(size);
+
+        std::ranges::generate(data, [&] { return static_cast<int>(rnd_gen()); });
+        check_sorted(data);
+
+        std::ranges::generate(data, [&] { return static_cast<int>(rnd_gen() % 4); }); // many duplicates
+        check_sorted(data);
+
+        std::ranges::sort(data);
+        check_sorted(data);
+
+        std::ranges::reverse(data);
+        check_sorted(data);
+    }
+
+    SECTION("custom comparator")
+    {
+        std::vector<double> data(1000);
+        std::ranges::generate(data, [&] { return static_cast<double>(rnd_gen() % 1000) / 10.0; });
+
+        helpers::hybrid_sort(data, std::greater{});
+        CHECK(std::ranges::is_sorted(data, std::greater{}));
+    }
+
+    SECTION("items that are expensive to copy are swapped in place")
+    {
+        std::vector<Counted> data;
+        for (int i = 0; i < 1000; ++i)
+            data.emplace_back(static_cast<int>(rnd_gen() % 1000));
+
+        Counted::copies = 0;
+        helpers::hybrid_sort(data, std::less{});
+
+        CHECK(Counted::copies == 0);
+        CHECK(std::ranges::is_sorted(data, std::less{}));
+    }
+}
+
+TEST_CASE("small sort - benchmark", "[.benchmark]")
+{
+    constexpr size_t total_size = 1 << 20;
+
+    std::mt19937 rnd_gen{665};
+    std::vector<int> source(total_size);
+    std::ranges::generate(source, [&] { return static_cast<int>(rnd_gen()); });
+    std::vector<int> data(total_size);
+
+    auto benchmark_size = [&]<size_t N>(std::integral_constant<size_t, N>) {
+        BENCHMARK("std::sort - arrays of " + std::to_string(N))
+        {
+            std::ranges::copy(source, data.begin());
+            for (size_t i = 0; i + N <= total_size; i += N)
+                std::sort(data.begin() + i, data.begin() + i + N);
+            return data[N - 1];
+        };
+
+        BENCHMARK("helpers::small_sort - arrays of " + std::to_string(N))
+        {
+            std::ranges::copy(source, data.begin());
+            for (size_t i = 0; i + N <= total_size; i += N)
+                helpers::small_sort(std::span<int, N>{data.data() + i, N});
+            return data[N - 1];
+        };
+    };
+
+    benchmark_size(std::integral_constant<size_t, 4>{});
+    benchmark_size(std::integral_constant<size_t, 8>{});
+    benchmark_size(std::integral_constant<size_t, 16>{});
+    benchmark_size(std::integral_constant<size_t, 32>{});
+}
+
+TEST_CASE("hybrid sort - benchmark", "[.benchmark]")
+{
+    constexpr size_t size = 10'000'000;
+
+    std::mt19937 rnd_gen{665};
+    std::vector<int> source(size);
+    std::ranges::generate(source, [&] { return static_cast<int>(rnd_gen()); });
+    std::vector<int> data(size);
+
+    BENCHMARK("std::sort - 10M items")
+    {
+        std::ranges::copy(source, data.begin());
+        std::sort(data.begin(), data.end());
+        return data.front();
+    };
+
+    BENCHMARK("helpers::hybrid_sort - 10M items")
+    {
+        std::ranges::copy(source, data.begin());
+        helpers::hybrid_sort(data);
+        return data.front();
+    };
+}
+
 template <typename TContainer>
 void custom_print(TContainer&& container)
 {
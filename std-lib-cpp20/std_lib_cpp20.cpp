@@ -1,10 +1,26 @@
+#include <algorithms.hpp>
+#include <checked_span.hpp>
+#include <md_span.hpp>
+#include <serialization.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <vector>
 #include <span>
 #include <string>
 #include <numeric>
 #include <numbers>
+#include <set>
+#include <tuple>
+#include <sstream>
+#include <stdexcept>
+#include <cstring>
+#include <cstdlib>
+#include <mutex>
 
 using namespace std::literals;
 
@@ -17,10 +33,7 @@ void print(std::span<const int> data)
 
 void zero(std::span<int> data, int zero_value = 0)
 {
-    for (auto& item : data)
-    {
-        item = zero_value;
-    }
+    helpers::algorithms::fill(data, zero_value); // memset, or streaming stores on many threads for huge buffers
 }
 
 TEST_CASE("std::span")
@@ -60,6 +73,221 @@ TEST_CASE("std::span - subspan")
 
         print(row_data);
     }
+
+    SECTION("rows of MdSpan")
+    {
+        helpers::MdSpan matrix{std::span{vec}, vec.size() / col_size, col_size};
+
+        for (size_t row = 0; row < matrix.extent(0); ++row)
+            print(matrix.row(row));
+
+        CHECK(matrix[3, 4] == 34);
+    }
+}
+
+TEST_CASE("MdSpan")
+{
+    using helpers::DExtents;
+    using helpers::Extents;
+    using helpers::MdSpan;
+
+    std::vector<int> buffer(12);
+    std::iota(buffer.begin(), buffer.end(), 0);
+
+    SECTION("extents")
+    {
+        Extents<3, std::dynamic_extent> extents{4};
+
+        static_assert(extents.rank() == 2);
+        static_assert(extents.rank_dynamic() == 1);
+        static_assert(sizeof(Extents<3, 4>) < sizeof(size_t)); // static extents are not stored
+        CHECK(extents.extent(0) == 3);
+        CHECK(extents.extent(1) == 4);
+        CHECK(extents.size() == 12);
+    }
+
+    SECTION("row-major")
+    {
+        MdSpan<int, Extents<3, 4>> matrix{buffer.data()};
+
+        CHECK(matrix[1, 2] == 6);
+        CHECK(std::ranges::equal(matrix.row(2), std::vector{8, 9, 10, 11}));
+
+        matrix[2, 3] = -1;
+        CHECK(buffer.back() == -1);
+    }
+
+    SECTION("column-major")
+    {
+        MdSpan<int, DExtents<2>, helpers::LayoutLeft> matrix{buffer.data(), 3, 4};
+
+        CHECK(matrix[1, 2] == 7);
+        CHECK(std::ranges::equal(matrix.column(1), std::vector{3, 4, 5}));
+    }
+
+    SECTION("3D")
+    {
+        MdSpan cube{buffer.data(), 2, 3, 2};
+
+        CHECK(cube[1, 2, 1] == 11);
+        CHECK(cube.mapping().stride(0) == 6);
+    }
+
+    SECTION("block of a matrix is a strided view")
+    {
+        MdSpan matrix{buffer.data(), 3, 4};
+        auto block = matrix.block(1, 1, 2, 2);
+
+        CHECK(block[0, 0] == 5);
+        CHECK(block[1, 1] == 10);
+
+        block[0, 1] = 0;
+        CHECK(matrix[1, 2] == 0);
+        CHECK(block.mapping().required_span_size() == 6);
+    }
+
+    SECTION("tiled layout")
+    {
+        using TiledLayout = helpers::LayoutTiled<4, 8>;
+        const TiledLayout::mapping<DExtents<2>> mapping{DExtents<2>{10, 13}};
+
+        CHECK(mapping.required_span_size() == 12 * 16); // padded to whole tiles
+        CHECK_FALSE(mapping.is_exhaustive());
+
+        std::set<size_t> offsets;
+        for (size_t row = 0; row < 10; ++row)
+            for (size_t col = 0; col < 13; ++col)
+                offsets.insert(mapping(row, col));
+
+        CHECK(offsets.size() == 10 * 13);
+        CHECK(*offsets.rbegin() < mapping.required_span_size());
+
+        CHECK(mapping(0, 7) == 7);
+        CHECK(mapping(1, 0) == 8);  // next row of tile
+        CHECK(mapping(0, 8) == 32); // next tile
+    }
+
+    SECTION("blocked iteration visits every index once")
+    {
+        std::vector<int> visits(7 * 10);
+        MdSpan counts{visits.data(), 7, 10};
+
+        helpers::for_each_index_blocked(7, 10, 4, [&](size_t row, size_t col) { ++counts[row, col]; });
+
+        CHECK(std::ranges::all_of(visits, [](int count) { return count == 1; }));
+    }
+}
+
+TEST_CASE("zero & fill of huge spans")
+{
+    constexpr size_t huge_size = 48 * 1024 * 1024; // above the streaming threshold
+
+    SECTION("chunks of threads start at page boundaries")
+    {
+        std::vector<int> vec(huge_size / sizeof(int) + 3);
+        const int* data = vec.data() + 1; // not page aligned
+
+        std::mutex mtx;
+        std::vector<std::pair<size_t, size_t>> chunks;
+        helpers::algorithms::Details::for_each_page_chunk(data, vec.size() - 1, [&](size_t first, size_t count) {
+            std::lock_guard lk{mtx};
+            chunks.emplace_back(first, count);
+        });
+        std::ranges::sort(chunks);
+
+        size_t expected_first = 0;
+        for (const auto& [first, count] : chunks)
+        {
+            CHECK(first == expected_first);
+            if (first != 0)
+                CHECK(reinterpret_cast<std::uintptr_t>(data + first) % helpers::algorithms::Details::page_size == 0);
+            expected_first = first + count;
+        }
+        CHECK(expected_first == vec.size() - 1);
+    }
+
+    SECTION("fill - unaligned span of ints")
+    {
+        std::vector<int> vec(huge_size / sizeof(int) + 3, -1);
+
+        zero(std::span{vec}.subspan(1, vec.size() - 2), 42);
+
+        CHECK(vec.front() == -1);
+        CHECK(vec.back() == -1);
+        CHECK(std::all_of(vec.begin() + 1, vec.end() - 1, [](int item) { return item == 42; }));
+    }
+
+    SECTION("fill - bytes at odd offset")
+    {
+        std::vector<uint8_t> vec(huge_size + 5, 0);
+
+        helpers::algorithms::fill(std::span{vec}.subspan(3, huge_size), uint8_t{0xAB});
+
+        CHECK(std::count(vec.begin(), vec.end(), 0xAB) == huge_size);
+        CHECK(vec[2] == 0);
+        CHECK(vec[huge_size + 3] == 0);
+    }
+
+    SECTION("fill - items that do not fit in a vector register")
+    {
+        struct Rgb
+        {
+            uint8_t r, g, b;
+        };
+
+        std::vector<Rgb> pixels(huge_size / sizeof(Rgb));
+        helpers::algorithms::fill(pixels, Rgb{1, 2, 3});
+
+        CHECK(std::all_of(pixels.begin(), pixels.end(), [](Rgb p) { return p.r == 1 && p.g == 2 && p.b == 3; }));
+    }
+
+    SECTION("zero")
+    {
+        std::vector<double> vec(huge_size / sizeof(double), 1.0);
+
+        helpers::algorithms::zero(vec);
+
+        CHECK(std::all_of(vec.begin(), vec.end(), [](double item) { return item == 0.0; }));
+    }
+}
+
+TEST_CASE("zero & fill of huge spans - benchmark", "[.benchmark]")
+{
+    constexpr size_t MB = 1024 * 1024;
+
+    std::vector<size_t> sizes = {1 * MB, 64 * MB};
+    if (std::getenv("BENCHMARK_HUGE_SPANS")) // 8 GB requires enough RAM
+        sizes.push_back(8192 * MB);
+
+    for (size_t size_bytes : sizes)
+    {
+        std::vector<int> buffer(size_bytes / sizeof(int));
+        const auto suffix = " - "s + std::to_string(size_bytes / MB) + " MB";
+
+        BENCHMARK("std::fill_n" + suffix)
+        {
+            std::fill_n(buffer.data(), buffer.size(), 42);
+            return buffer.back();
+        };
+
+        BENCHMARK("helpers::algorithms::fill" + suffix)
+        {
+            helpers::algorithms::fill(buffer, 42);
+            return buffer.back();
+        };
+
+        BENCHMARK("memset" + suffix)
+        {
+            std::memset(buffer.data(), 0, size_bytes);
+            return buffer.back();
+        };
+
+        BENCHMARK("helpers::algorithms::zero" + suffix)
+        {
+            helpers::algorithms::zero(buffer);
+            return buffer.back();
+        };
+    }
 }
 
 void print_as_bytes(const float f, const std::span<const std::byte> bytes)
@@ -94,6 +322,220 @@ constexpr std::span<int> get_head(std::span<int> items, size_t head_size = 1)
     return items.first(head_size);
 }
 
+struct PersonRecord
+{
+    uint64_t id;
+    char name[32];
+    uint32_t age;
+    float salary;
+
+    bool operator==(const PersonRecord& other) const
+    {
+        return id == other.id && std::strcmp(name, other.name) == 0 && age == other.age && salary == other.salary;
+    }
+
+    // members converted to/from wire byte order (structured bindings cannot count members of structs with arrays)
+    friend auto wire_members(PersonRecord& person)
+    {
+        return std::tie(person.id, person.name, person.age, person.salary);
+    }
+};
+
+TEST_CASE("binary serialization")
+{
+    std::vector<std::byte> buffer(1024);
+
+    const std::vector<PersonRecord> people = {{1, "Jan Kowalski", 42, 8'000.0f}, {2, "Adam Nowak", 33, 6'500.5f}};
+
+    SECTION("values & spans")
+    {
+        helpers::BinaryWriter writer{buffer};
+        writer.write(std::numbers::pi_v<float>);
+        writer.write(uint16_t{0xABCD});
+        writer.write(std::span{people});
+
+        CHECK(writer.position() == sizeof(float) + sizeof(uint16_t) + 2 * sizeof(PersonRecord));
+
+        helpers::BinaryReader reader{writer.written()};
+        CHECK(reader.read<float>() == std::numbers::pi_v<float>);
+        CHECK(reader.read<uint16_t>() == 0xABCD);
+
+        std::vector<PersonRecord> loaded(2);
+        reader.read(std::span{loaded});
+        CHECK(loaded == people);
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("wire format is little-endian")
+    {
+        helpers::BinaryWriter writer{buffer};
+        writer.write(uint32_t{0x01020304});
+
+        CHECK(std::ranges::equal(writer.written(), std::vector{std::byte{4}, std::byte{3}, std::byte{2}, std::byte{1}}));
+
+        PersonRecord person = people[0];
+        helpers::Details::swap_bytes(person);
+        CHECK(person.age == std::byteswap(uint32_t{42}));
+        helpers::Details::swap_bytes(person);
+        CHECK(person == people[0]);
+    }
+
+    SECTION("read in place")
+    {
+        helpers::BinaryWriter writer{buffer};
+        writer.write(uint8_t{2});
+        writer.align(alignof(PersonRecord));
+        writer.write(std::span{people});
+
+        helpers::BinaryReader reader{writer.written()};
+        const auto count = reader.read<uint8_t>();
+        reader.align(alignof(PersonRecord));
+        std::span<const PersonRecord> records = reader.view<PersonRecord>(count);
+
+        CHECK(std::ranges::equal(records, people));
+        CHECK(reinterpret_cast<const std::byte*>(records.data()) == buffer.data() + alignof(PersonRecord)); // no copy
+    }
+
+    SECTION("types that hold addresses are rejected")
+    {
+        struct Reading
+        {
+            uint32_t sensor_id;
+            double value;
+        };
+
+        struct Tagged
+        {
+            uint32_t id;
+            const char* tag;
+        };
+
+        struct Named
+        {
+            uint32_t id;
+            std::string_view name;
+        };
+
+        static_assert(helpers::Serializable<PersonRecord>);
+        static_assert(!helpers::Serializable<int*>);
+        static_assert(!helpers::Serializable<std::string_view>);
+        static_assert(!helpers::Serializable<std::span<const int>>);
+        static_assert(!helpers::Serializable<Tagged>);
+        static_assert(!helpers::Serializable<Named>);
+
+        struct Batch
+        {
+            Reading first;
+            Tagged last; // pointer in a nested struct
+        };
+
+        static_assert(helpers::Serializable<Reading[2]>);
+        static_assert(!helpers::Serializable<Batch>);
+        static_assert(!helpers::Serializable<std::array<const char*, 2>>);
+    }
+
+    SECTION("records whose members cannot be listed are accepted")
+    {
+        struct Wide
+        {
+            uint32_t a, b, c, d, e, f, g, h, i;
+        };
+
+        struct Header
+        {
+            uint32_t magic;
+        };
+
+        struct Derived : Header
+        {
+            uint16_t version;
+        };
+
+        struct WithArray
+        {
+            uint32_t id;
+            char code[4];
+        };
+
+        static_assert(helpers::Serializable<std::array<int, 16>>);
+        static_assert(helpers::Serializable<Wide>);
+        static_assert(helpers::Serializable<Derived>);
+        static_assert(helpers::Serializable<WithArray>);
+    }
+
+    SECTION("buffer overrun throws")
+    {
+        helpers::BinaryWriter writer{std::span{buffer}.first(3)};
+        CHECK_THROWS_AS(writer.write(uint32_t{1}), std::out_of_range);
+
+        helpers::BinaryReader reader{std::span{buffer}.first(3)};
+        CHECK_THROWS_AS(reader.read<uint32_t>(), std::out_of_range);
+        CHECK_THROWS_AS(reader.view<uint16_t>(2), std::out_of_range);
+    }
+}
+
+TEST_CASE("binary serialization - benchmark", "[.benchmark]")
+{
+    constexpr size_t count = 10'000'000;
+    constexpr size_t size_mb = count * sizeof(PersonRecord) / (1024 * 1024);
+
+    std::vector<PersonRecord> people(count);
+    for (size_t i = 0; i < count; ++i)
+        people[i] = {i, "Jan Kowalski", static_cast<uint32_t>(i % 100), static_cast<float>(i)};
+
+    std::vector<std::byte> buffer(count * sizeof(PersonRecord));
+
+    BENCHMARK("iostream - write " + std::to_string(size_mb) + " MB")
+    {
+        std::ostringstream out;
+        for (const auto& person : people)
+        {
+            out.write(reinterpret_cast<const char*>(&person.id), sizeof(person.id));
+            out.write(person.name, sizeof(person.name));
+            out.write(reinterpret_cast<const char*>(&person.age), sizeof(person.age));
+            out.write(reinterpret_cast<const char*>(&person.salary), sizeof(person.salary));
+        }
+        return out.tellp();
+    };
+
+    BENCHMARK("BinaryWriter - write " + std::to_string(size_mb) + " MB")
+    {
+        helpers::BinaryWriter writer{buffer};
+        writer.write(std::span{people});
+        return writer.position();
+    };
+
+    helpers::BinaryWriter{buffer}.write(std::span{people});
+    const std::string serialized(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    std::vector<PersonRecord> loaded(count);
+
+    BENCHMARK("iostream - read " + std::to_string(size_mb) + " MB")
+    {
+        std::istringstream in{serialized};
+        for (auto& person : loaded)
+        {
+            in.read(reinterpret_cast<char*>(&person.id), sizeof(person.id));
+            in.read(person.name, sizeof(person.name));
+            in.read(reinterpret_cast<char*>(&person.age), sizeof(person.age));
+            in.read(reinterpret_cast<char*>(&person.salary), sizeof(person.salary));
+        }
+        return loaded.back().age;
+    };
+
+    BENCHMARK("BinaryReader - read " + std::to_string(size_mb) + " MB")
+    {
+        helpers::BinaryReader reader{buffer};
+        reader.read(std::span{loaded});
+        return loaded.back().age;
+    };
+
+    BENCHMARK("BinaryReader - view " + std::to_string(size_mb) + " MB")
+    {
+        helpers::BinaryReader reader{buffer};
+        return reader.view<PersonRecord>(count).back().age;
+    };
+}
+
 TEST_CASE("dangling pointers with span")
 {
     std::vector vec = {1, 2, 3, 4, 5};
@@ -104,6 +546,131 @@ TEST_CASE("dangling pointers with span")
     print(head); // UB
 }
 
+TEST_CASE("dangling span is detected by checked span")
+{
+    helpers::checked::Vector<int> vec = {1, 2, 3, 4, 5};
+    vec.shrink_to_fit();
+
+    auto head = vec.span().first(3);
+    CHECK(head[0] == 1);
+
+    SECTION("reallocation invalidates spans")
+    {
+        vec.push_back(6);
+
+        CHECK_FALSE(head.is_valid());
+        CHECK_THROWS_AS(head[0], helpers::DanglingSpanError);
+        CHECK_THROWS_AS(print(head), helpers::DanglingSpanError);
+    }
+
+    SECTION("push_back without reallocation keeps spans valid")
+    {
+        vec.reserve(100);
+        head = vec.span().first(3);
+
+        vec.push_back(6);
+
+        CHECK(head.is_valid());
+        CHECK(head[2] == 3);
+    }
+
+    SECTION("removing items invalidates spans")
+    {
+        vec.pop_back();
+        CHECK_THROWS_AS(head.front(), helpers::DanglingSpanError);
+    }
+
+    SECTION("destruction of vector invalidates spans")
+    {
+        helpers::checked::Span<const int> tail;
+        {
+            helpers::checked::Vector<int> temp = {1, 2, 3};
+            tail = temp.span().last(1);
+        }
+        CHECK_THROWS_AS(tail.back(), helpers::DanglingSpanError);
+    }
+
+    SECTION("moved vector keeps spans valid")
+    {
+        auto target = std::move(vec);
+        CHECK(head[1] == 2);
+    }
+}
+
+TEST_CASE("CheckedSpan - checked in debug builds only")
+{
+    helpers::CheckedVector<int> vec = {1, 2, 3};
+    helpers::CheckedSpan<int> items = helpers::checked_span(vec);
+
+#if HELPERS_CHECKED_SPANS
+    static_assert(std::same_as<decltype(items), helpers::checked::Span<int>>);
+#else
+    static_assert(std::same_as<decltype(items), std::span<int>>);
+#endif
+
+    CHECK(items[2] == 3);
+}
+
+TEST_CASE("CheckedSpan - benchmark", "[.benchmark]")
+{
+    constexpr size_t size = 10'000'000;
+
+    std::vector<int> std_vec(size, 1);
+    helpers::checked::Vector<int> checked_vec(size, 1);
+
+    std::span<int> std_span{std_vec};
+    helpers::checked::Span<int> checked_span = checked_vec.span();
+
+    BENCHMARK("std::span - index")
+    {
+        int sum = 0;
+        for (size_t i = 0; i < std_span.size(); ++i)
+            sum += std_span[i];
+        return sum;
+    };
+
+    BENCHMARK("checked::Span - index")
+    {
+        int sum = 0;
+        for (size_t i = 0; i < checked_span.size(); ++i)
+            sum += checked_span[i];
+        return sum;
+    };
+
+    BENCHMARK("std::span - range-based for")
+    {
+        int sum = 0;
+        for (int item : std_span)
+            sum += item;
+        return sum;
+    };
+
+    BENCHMARK("checked::Span - range-based for")
+    {
+        int sum = 0;
+        for (int item : checked_span)
+            sum += item;
+        return sum;
+    };
+
+    BENCHMARK("std::vector - push_back")
+    {
+        std::vector<int> vec;
+        for (size_t i = 0; i < 1'000'000; ++i)
+            vec.push_back(static_cast<int>(i));
+        return vec.size();
+    };
+
+    BENCHMARK("checked::Vector - push_back (with span)")
+    {
+        helpers::checked::Vector<int> vec;
+        auto items = vec.span();
+        for (size_t i = 0; i < 1'000'000; ++i)
+            vec.push_back(static_cast<int>(i));
+        return vec.size() + items.is_valid();
+    };
+}
+
 constexpr int test_ub()
 {
     std::vector vec = {1, 2, 3, 4, 5};
@@ -122,4 +689,89 @@ constexpr int test_ub()
 TEST_CASE("test ub")
 {
     constexpr auto value = test_ub();
-}
\ No newline at end of file
+}
+
+namespace
+{
+    constexpr size_t tile = 64;
+
+    using TiledMatrix = helpers::MdSpan<float, helpers::DExtents<2>, helpers::LayoutTiled<tile, tile>>;
+
+    template <typename TMatrix>
+    void stencil_5(const TMatrix& in, const TMatrix& out, size_t row, size_t col)
+    {
+        out[row, col] = (in[row - 1, col] + in[row + 1, col] + in[row, col - 1] + in[row, col + 1] + in[row, col]) / 5.0f;
+    }
+} // namespace
+
+TEST_CASE("MdSpan - benchmark", "[.benchmark]")
+{
+    constexpr size_t n = 8 * 1024;
+
+    std::vector<float> src_buffer(n * n);
+    std::vector<float> dest_buffer(n * n);
+    std::iota(src_buffer.begin(), src_buffer.end(), 0.0f);
+
+    helpers::MdSpan src{std::span{src_buffer}, n, n};
+    helpers::MdSpan dest{std::span{dest_buffer}, n, n};
+
+    TiledMatrix tiled_src{std::span{src_buffer}, n, n};
+    TiledMatrix tiled_dest{std::span{dest_buffer}, n, n};
+
+    BENCHMARK("transpose - naive")
+    {
+        for (size_t row = 0; row < n; ++row)
+            for (size_t col = 0; col < n; ++col)
+                dest[col, row] = src[row, col];
+        return dest[1, 0];
+    };
+
+    BENCHMARK("transpose - blocked iteration")
+    {
+        helpers::for_each_index_blocked(n, n, tile, [&](size_t row, size_t col) { dest[col, row] = src[row, col]; });
+        return dest[1, 0];
+    };
+
+    BENCHMARK("transpose - tiled layout")
+    {
+        // tile (r, c) of src is tile (c, r) of dest - both are contiguous blocks of memory
+        helpers::for_each_tile(tiled_src, [&](size_t row_first, size_t col_first, size_t rows, size_t cols) {
+            const float* in = &tiled_src[row_first, col_first];
+            float* out = &tiled_dest[col_first, row_first];
+            for (size_t row = 0; row < rows; ++row)
+                for (size_t col = 0; col < cols; ++col)
+                    out[col * tile + row] = in[row * tile + col];
+        });
+        return tiled_dest[1, 0];
+    };
+
+    BENCHMARK("stencil - row-major, row by row")
+    {
+        for (size_t row = 1; row < n - 1; ++row)
+            for (size_t col = 1; col < n - 1; ++col)
+                stencil_5(src, dest, row, col);
+        return dest[1, 1];
+    };
+
+    BENCHMARK("stencil - row-major, column by column")
+    {
+        for (size_t col = 1; col < n - 1; ++col)
+            for (size_t row = 1; row < n - 1; ++row)
+                stencil_5(src, dest, row, col);
+        return dest[1, 1];
+    };
+
+    BENCHMARK("stencil - tiled layout, column by column")
+    {
+        for (size_t col = 1; col < n - 1; ++col)
+            for (size_t row = 1; row < n - 1; ++row)
+                stencil_5(tiled_src, tiled_dest, row, col);
+        return tiled_dest[1, 1];
+    };
+
+    BENCHMARK("stencil - tiled layout, tile by tile")
+    {
+        helpers::for_each_index_blocked(n - 2, n - 2, tile, [&](size_t row, size_t col) { stencil_5(tiled_src, tiled_dest, row + 1, col + 1); });
+        return tiled_dest[1, 1];
+    };
+}
@@ -1,11 +1,14 @@
 #include "helpers.hpp"
 
 #include <bit>
+#include <cassert>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <memory>
 #include <set>
 #include <source_location>
+#include <span>
 #include <string>
 #include <variant>
 #include <vector>
@@ -295,6 +298,103 @@ TEST_CASE("NTTP")
     CHECK(scale<3.14f>(2) == 6.28f); 
 }
 
+////////////////////////////////////////////////////////////
+// NTTP - compile-time dispatch for span kernels
+
+// Factor may be a number or a structural type with a `value` member (like Tax)
+template <auto Factor>
+constexpr auto factor_of()
+{
+    if constexpr (requires { Factor.value; })
+        return Factor.value;
+    else
+        return Factor;
+}
+
+template <auto Factor>
+concept PowerOf2Factor = std::integral<decltype(Factor)> && (Factor > 0)
+    && PowerOf2<static_cast<std::make_unsigned_t<decltype(Factor)>>(Factor)>;
+
+static_assert(PowerOf2Factor<8>);
+static_assert(!PowerOf2Factor<-8>);
+static_assert(!PowerOf2Factor<6>);
+static_assert(!PowerOf2Factor<8.0>);
+
+template <typename T>
+concept Scalable = std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+template <auto Factor, Scalable T>
+constexpr T scaled(T x)
+{
+    constexpr auto factor = factor_of<Factor>();
+
+    if constexpr (factor == 0)
+        return T{};
+    else if constexpr (factor == 1)
+        return x;
+    else if constexpr (std::integral<T> && PowerOf2Factor<factor>)
+    {
+        constexpr int shift = std::countr_zero(static_cast<std::make_unsigned_t<decltype(factor)>>(factor));
+        return static_cast<T>(static_cast<std::make_unsigned_t<T>>(x) << shift); // wraps like x * factor
+    }
+    else
+        return static_cast<T>(x * factor);
+}
+
+// branch selection happens at compile time - the loops are branch-free and auto-vectorize
+template <auto Factor, Scalable T>
+void scale(std::span<T> data)
+{
+    for (auto& item : data)
+        item = scaled<Factor>(item);
+}
+
+template <auto Factor, Scalable T, Scalable TResult>
+void scale(std::span<const T> data, std::span<TResult> result)
+{
+    assert(data.size() == result.size());
+
+    for (size_t i = 0; i < data.size(); ++i)
+        result[i] = scaled<Factor>(static_cast<TResult>(data[i]));
+}
+
+TEST_CASE("NTTP - span kernels")
+{
+    SECTION("power of 2 factor for integers is a shift")
+    {
+        std::vector vec = {1, -2, 3, -4};
+        scale<8>(std::span{vec});
+        CHECK(vec == std::vector{8, -16, 24, -32});
+    }
+
+    SECTION("factor 1 & 0 are folded")
+    {
+        std::vector vec = {1, 2, 3};
+        scale<1>(std::span{vec});
+        CHECK(vec == std::vector{1, 2, 3});
+
+        scale<0>(std::span{vec});
+        CHECK(vec == std::vector{0, 0, 0});
+    }
+
+    SECTION("floating point factor")
+    {
+        std::vector vec = {1.0, 2.0, 4.0};
+        scale<0.5>(std::span{vec});
+        CHECK(vec == std::vector{0.5, 1.0, 2.0});
+    }
+
+    SECTION("result stored in other span")
+    {
+        const std::vector vec = {1, 2, 3};
+        std::vector<double> result(vec.size());
+        scale<3.14>(std::span{vec}, std::span{result});
+
+        for (size_t i = 0; i < vec.size(); ++i)
+            CHECK(result[i] == scale<3.14>(vec[i]));
+    }
+}
+
 ///////////////////////////////////////////
 
 struct Tax
@@ -321,6 +421,52 @@ TEST_CASE("structural types")
     CHECK(calc_gross_price<Tax{0.22}>(100.0) == 119.0);
 }
 
+// one fused pass over a batch of prices - the same formula as the scalar version gives the same results
+template <Tax Vat>
+void calc_gross_price(std::span<const double> net_prices, std::span<double> gross_prices)
+{
+    assert(net_prices.size() == gross_prices.size());
+
+    for (size_t i = 0; i < net_prices.size(); ++i)
+        gross_prices[i] = net_prices[i] + net_prices[i] * Vat.value;
+}
+
+template <Tax Vat>
+void calc_gross_price(std::span<double> prices)
+{
+    calc_gross_price<Vat>(prices, prices);
+}
+
+TEST_CASE("structural types - span kernels")
+{
+    constexpr Tax vat_pl{0.23};
+
+    SECTION("Tax as a scale factor")
+    {
+        std::vector vec = {100.0, 200.0};
+        scale<vat_pl>(std::span{vec});
+        CHECK(vec == std::vector{100.0 * 0.23, 200.0 * 0.23});
+    }
+
+    SECTION("gross prices for a batch")
+    {
+        const std::vector net_prices = {100.0, 9.99, 0.01, 1'000'000.0};
+        std::vector<double> gross_prices(net_prices.size());
+
+        calc_gross_price<vat_pl>(net_prices, gross_prices);
+
+        for (size_t i = 0; i < net_prices.size(); ++i)
+            CHECK(gross_prices[i] == calc_gross_price<vat_pl>(net_prices[i]));
+    }
+
+    SECTION("gross prices in place")
+    {
+        std::vector prices = {100.0, 200.0};
+        calc_gross_price<vat_pl>(prices);
+        CHECK(prices == std::vector{123.0, 246.0});
+    }
+}
+
 template <size_t N>
 struct Str
 {
@@ -371,4 +517,43 @@ TEST_CASE("NTTP + lambda")
 
     constexpr static auto vat_ger = []{ return 0.19; };
     CHECK(calc_gross_price<vat_ger>(100.0) == 119.0);
-}
\ No newline at end of file
+}
+
+TEST_CASE("NTTP span kernels - benchmark", "[.benchmark]")
+{
+    constexpr Tax vat_pl{0.23};
+    constexpr size_t batch_size = 100'000'000;
+
+    const std::vector<double> net_prices(batch_size, 99.99);
+    std::vector<double> gross_prices(batch_size);
+
+    BENCHMARK("calc_gross_price<Vat>(double) - called in a loop")
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+            gross_prices[i] = calc_gross_price<vat_pl>(net_prices[i]);
+        return gross_prices.back();
+    };
+
+    BENCHMARK("calc_gross_price<Vat>(span) - fused kernel")
+    {
+        calc_gross_price<vat_pl>(net_prices, gross_prices);
+        return gross_prices.back();
+    };
+
+    // out of place - scaling in place across samples would overflow int after a few runs
+    const std::vector<int> quantities(batch_size, 3);
+    std::vector<int> scaled_quantities(batch_size);
+
+    BENCHMARK("scale<8>(int) - called in a loop")
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+            scaled_quantities[i] = scale<8>(quantities[i]);
+        return scaled_quantities.back();
+    };
+
+    BENCHMARK("scale<8>(span<int>) - shift kernel")
+    {
+        scale<8>(std::span{quantities}, std::span{scaled_quantities});
+        return scaled_quantities.back();
+    };
+}